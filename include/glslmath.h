@@ -1,5 +1,9 @@
 ﻿#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <algorithm>
+#include <limits>
+#include <type_traits>
 
 #if defined(_MSC_VER)
 	#include <intrin.h>
@@ -13,6 +17,16 @@
 #ifndef	GLSLVMATH_H
 #define	GLSLVMATH_H
 
+/*
+	ベクトル行列の共用体は、SWIZZLE ごとに異なる型のメンバを通して同じ成分を読み書きする。
+	型ベースのエイリアス解析で別物と見なされないよう、これらの型は may_alias とする。
+*/
+#if defined(_MSC_VER)
+	#define GLSLMATH_MAY_ALIAS
+#else
+	#define GLSLMATH_MAY_ALIAS __attribute__((__may_alias__))
+#endif
+
 
 namespace glslmath {
 
@@ -51,6 +65,35 @@ struct Traits {
 		i2 = (swizzle >>  8) & 15,
 		i3 = (swizzle >> 12) & 15,
 
+		/* SWIZZLE が恒等変換か？ */
+		isIdentitySwizzle = (((swizzle ^ 0x3210) & ((1 << (opeDim * 4)) - 1)) == 0),
+
+		/*
+			パディング付きの型か？
+			GenVec2 で生成された opeDim < memDim の型は、演算次元を超える成分をパディングとして持つ。
+			（SWIZZLE メンバの SWIZZLE は演算次元数分の桁しか持たないので区別できる）
+		*/
+		isPadded = (opeDim < memDim && swizzle == 0x3210),
+
+		/* 中間値のメモリ次元数（パディング付きの型はパディングを保つ）*/
+		tempMemDim = (opeDim < memDim && swizzle == 0x3210)? memDim : opeDim,
+
+		/* 書き込み先となるメモリ成分のビットマスク */
+		writeMask = (
+			(opeDim >= 1 ? (1 << i0) : 0)
+		|	(opeDim >= 2 ? (1 << i1) : 0)
+		|	(opeDim >= 3 ? (1 << i2) : 0)
+		|	(opeDim >= 4 ? (1 << i3) : 0)
+		),
+
+		/* SWIZZLE の逆変換（メモリ成分 j に書き込まれる演算成分のインデクス。書き込まれない成分は j とする）*/
+		inverseSwizzle = (
+			(((opeDim >= 4 && i3 == 0) ? 3 : (opeDim >= 3 && i2 == 0) ? 2 : (opeDim >= 2 && i1 == 0) ? 1 : 0)      )
+		|	(((opeDim >= 4 && i3 == 1) ? 3 : (opeDim >= 3 && i2 == 1) ? 2 : (opeDim >= 2 && i1 == 1) ? 1 : (i0 == 1) ? 0 : 1) <<  4)
+		|	(((opeDim >= 4 && i3 == 2) ? 3 : (opeDim >= 3 && i2 == 2) ? 2 : (opeDim >= 2 && i1 == 2) ? 1 : (i0 == 2) ? 0 : 2) <<  8)
+		|	(((opeDim >= 4 && i3 == 3) ? 3 : (opeDim >= 3 && i2 == 3) ? 2 : (opeDim >= 2 && i1 == 3) ? 1 : (i0 == 3) ? 0 : 3) << 12)
+		),
+
 		/* メンバ重複があるか？ */
 		hasDuplicatedMember = (
 			(opeDim >= 4 && (i3 == i0 || i3 == i1 || i3 == i2))
@@ -68,6 +111,30 @@ struct Traits {
 	};
 };
 
+/*=============================================================================
+▼	行列の型情報を保持する構造体
+-----------------------------------------------------------------------------*/
+template<int opeDimC_, int memDimC_, int opeDimR_, int memDimR_, int recursiveCount_>
+struct MatTraits {
+	enum {
+		/*
+			パディング付きの行列か？
+			GenMat2 で生成された opeDimR < memDimR の行列は、各列の演算次元を超える成分をパディングとして持つ。
+			（行列の SWIZZLE メンバは recursiveCount が 1 以上なので区別できる）
+		*/
+		isPadded = (opeDimR_ < memDimR_ && opeDimC_ == memDimC_ && recursiveCount_ == 0),
+
+		/* 中間値の列のメモリ次元数（パディング付きの行列はパディングを保つ）*/
+		tempMemDimR = (opeDimR_ < memDimR_ && opeDimC_ == memDimC_ && recursiveCount_ == 0)? memDimR_ : opeDimR_,
+
+		/*
+			opeDimC 次元のベクトル（行列との積を取るベクトル、転置後の列）の中間値のメモリ次元数
+			パディング付きの正方行列の場合のみパディングを保つ。
+		*/
+		tempMemDimC = (opeDimR_ < memDimR_ && opeDimC_ == memDimC_ && recursiveCount_ == 0 && opeDimC_ == opeDimR_)? memDimR_ : opeDimC_,
+	};
+};
+
 
 /*=============================================================================
 ▼	指定次元数のベクトル型を生成
@@ -81,9 +148,15 @@ using GenVec2 = Vec<Element_t, Traits<opeDim, memDim, 0x03210>, 0>;
 template<typename Element_t, int dim>
 using GenIvec = Ivec<Element_t, Traits<dim, dim, 0x03210>, 0>;
 
+template<typename Element_t, int opeDim, int memDim>
+using GenIvec2 = Ivec<Element_t, Traits<opeDim, memDim, 0x03210>, 0>;
+
 template<typename Element_t, int dim>
 using GenBvec = Bvec<Element_t, Traits<dim, dim, 0x03210>, 0>;
 
+template<typename Element_t, int opeDim, int memDim>
+using GenBvec2 = Bvec<Element_t, Traits<opeDim, memDim, 0x03210>, 0>;
+
 
 /*=============================================================================
 ▼	指定次元数の行列型を生成
@@ -91,33 +164,71 @@ using GenBvec = Bvec<Element_t, Traits<dim, dim, 0x03210>, 0>;
 template<typename Element_t, int opeDimC, int opeDimR>
 using GenMat = Mat<Element_t, opeDimC, opeDimC, opeDimR, opeDimR, 0>;
 
+template<typename Element_t, int opeDimC, int opeDimR, int memDimR>
+using GenMat2 = Mat<Element_t, opeDimC, opeDimC, opeDimR, memDimR, 0>;
+
+
+/*=============================================================================
+▼	レーンマスク形式の bool
+-----------------------------------------------------------------------------*/
+/*
+	true を全ビット 1、false を 0 で表す 32 bit の bool。
+	Bvec の成分型に用いると、SIMD の比較結果のマスクをそのまま保持できる。
+*/
+class LaneBool {
+public:
+	/* 全ビット 1 または 0 */
+	int bits;
+
+	/* コンストラクタ */
+	LaneBool() = default;
+	inline LaneBool(bool param) : bits(param? -1 : 0) {}
+
+	/* bool への変換 */
+	inline operator bool() const { return bits != 0; }
+};
+
+/* 成分を単独で読み書きする際のスカラ型（LaneBool は bool として扱う）*/
+template<typename Element_t>
+struct ScalarType {
+	using Type_t = Element_t;
+};
+
+template<>
+struct ScalarType<LaneBool> {
+	using Type_t = bool;
+};
+
 
 /*=============================================================================
 ▼	メンバアクセス用
 -----------------------------------------------------------------------------*/
 template<typename Element0_t, int memDim0, int index0>
-class ScalarInVec {
+class GLSLMATH_MAY_ALIAS ScalarInVec {
 private:
 	/* 自分自身の型 */
 	using This_t = ScalarInVec<Element0_t, memDim0, index0>;
 
+	/* スカラ型 */
+	using Scalar_t = typename ScalarType<Element0_t>::Type_t;
+
 public:
 	/* ベクトル成分 */
 	Element0_t elements[memDim0];
 
 	/* スカラ出力 */
-	inline operator Element0_t(){
+	inline operator Scalar_t(){
 		static_assert(index0 < memDim0);
 		return this->elements[index0];
 	}
-	inline operator Element0_t() const {
+	inline operator Scalar_t() const {
 		static_assert(index0 < memDim0);
 		return this->elements[index0];
 	}
 
 	/* スカラから代入 */
 	inline This_t& operator=(
-		Element0_t param
+		Scalar_t param
 	){
 		static_assert(index0 < memDim0);
 		this->elements[index0] = param;
@@ -137,7 +248,7 @@ public:
 
 	/* キャスト（暗黙に行われるスカラからのキャスト）*/
 	ScalarInVec<Element0_t, memDim0, index0>(
-		Element0_t param
+		Scalar_t param
 	){
 		static_assert(index0 < memDim0);
 		this->elements[index0] = param;
@@ -163,33 +274,1919 @@ static inline const Element0_t * operator&(
 }
 
 
+/*=============================================================================
+▼	命令セット
+-----------------------------------------------------------------------------*/
+/*
+	SSE/SSE2 は常に利用可能とみなす。
+	それ以外の命令セットはコンパイラの定義済みマクロから判定する。
+	利用者が事前に 0 を定義すれば、該当する命令セットの利用を抑止できる。
+*/
+#ifndef GLSLMATH_USE_SSE4_1
+	#if defined(__SSE4_1__) || defined(__AVX__)
+		#define GLSLMATH_USE_SSE4_1	1
+	#else
+		#define GLSLMATH_USE_SSE4_1	0
+	#endif
+#endif
+
+#ifndef GLSLMATH_USE_AVX
+	#if defined(__AVX__)
+		#define GLSLMATH_USE_AVX	1
+	#else
+		#define GLSLMATH_USE_AVX	0
+	#endif
+#endif
+
+#ifndef GLSLMATH_USE_AVX2
+	#if defined(__AVX2__)
+		#define GLSLMATH_USE_AVX2	1
+	#else
+		#define GLSLMATH_USE_AVX2	0
+	#endif
+#endif
+
+#ifndef GLSLMATH_USE_FMA
+	/* MSVC は __FMA__ を定義しないので、/arch:AVX2 を FMA 命令が使える目安とする */
+	#if defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__))
+		#define GLSLMATH_USE_FMA	1
+	#else
+		#define GLSLMATH_USE_FMA	0
+	#endif
+#endif
+
+
+/*=============================================================================
+▼	精度
+-----------------------------------------------------------------------------*/
+/*
+	float の invertsqrt normalize は、既定では rsqrt 命令の近似値をニュートン法で 1 回改良して求める
+	（相対誤差は全ての正の正規化数に対する実測で 2.8e-7 以下。rsqrt 命令の近似値は CPU によって異なり得る。スカラの invertsqrt(float) も同様）。
+	+0 と非正規化数に対しては +inf、-0 に対しては -inf、inf に対しては 0 になる（非正規化数は正しい値にならない）。
+	利用者が事前に 1 を定義すれば、除算と平方根による完全な精度の計算に切り替わる。
+*/
+#ifndef GLSLMATH_PRECISE_INVERTSQRT
+	#define GLSLMATH_PRECISE_INVERTSQRT	0
+#endif
+
+/*
+	sin cos tan sincos exp log exp2 log2 pow は、既定では FMA 命令が使える場合に限り SIMD の近似計算で求める
+	（誤差は数 ulp 程度。GenSimdVecFunctions の各関数の説明を参照）。
+	FMA 命令が無い場合は、成分ごとに標準ライブラリを呼ぶ方が速い環境があるため標準ライブラリを用いる。
+	利用者が事前に 0 または 1 を定義すれば、どちらかに固定できる。
+*/
+#ifndef GLSLMATH_USE_SIMD_TRANSCENDENTAL
+	#define GLSLMATH_USE_SIMD_TRANSCENDENTAL	GLSLMATH_USE_FMA
+#endif
+
+
 /*=============================================================================
 ▼	SIMD 型
 -----------------------------------------------------------------------------*/
+/* SIMD レジスタ型 */
+template<typename Element_t, int dim>
+struct GenSimdVecType {
+	typedef Element_t IntrinsicType_t[dim];
+};
+
+template<>
+struct GenSimdVecType<float, 4> {
+	typedef __m128 IntrinsicType_t;
+};
+
+template<>
+struct GenSimdVecType<int, 4> {
+	typedef __m128i IntrinsicType_t;
+};
+
+template<>
+struct GenSimdVecType<unsigned int, 4> {
+	typedef __m128i IntrinsicType_t;
+};
+
+template<>
+struct GenSimdVecType<double, 2> {
+	typedef __m128d IntrinsicType_t;
+};
+
+template<>
+struct GenSimdVecType<double, 4> {
+	typedef __m256d IntrinsicType_t;
+};
+
+/*
+	isSimd が 1 の型は、IntrinsicType_t に対する演算を静的メンバ関数として提供する。
+	isSimd が 0 の型の静的メンバ関数は参照されない。
+*/
 template<typename Element_t, int dim>
 struct GenSimdVecTraits {
 	typedef Element_t IntrinsicType_t[dim];
 	enum {
 		isM128 = 0,
 		isM256 = 0,
+		isSimd = 0,
 	};
 };
 
+template<typename Element_t, typename Traits_t>
+struct SimdPath {
+	enum {
+		/* SIMD レジスタ上で SWIZZLE を解決して読み出せるか？ */
+		isReadable =
+			GenSimdVecTraits<Element_t, Traits_t::memDim>::isSimd
+		&&	(Traits_t::opeDim == Traits_t::memDim || Traits_t::isPadded),
+
+		/* SWIZZLE を伴わず、全成分を SIMD 型のまま演算できるか？ */
+		isEnabled =
+			isReadable
+		&&	Traits_t::isIdentitySwizzle
+	};
+
+	/*
+		4 成分の SIMD 型に詰めて読み出す（SWIZZLE はレジスタ上で解決する。演算次元を超える成分の値は不定）
+		SIMD 演算できない型（vec2 vec3 など）を 4 成分の SIMD 演算に通す場合に用いる。
+		スカラ書き込みを経由しないので、ストアフォワーディングの失敗を起こさない。
+	*/
+	static inline auto LoadWidened(const Element_t *pElements){
+		using SimdVecTraits_t = GenSimdVecTraits<Element_t, 4>;
+		const auto simdVec = SimdVecTraits_t::template LoadPartial<Traits_t::memDim>(pElements);
+		if constexpr (Traits_t::isIdentitySwizzle) {
+			return simdVec;
+		} else {
+			return SimdVecTraits_t::template Swizzle<Traits_t::swizzle>(simdVec);
+		}
+	}
+
+	/*
+		パディング付きの浮動小数点型の演算では、結果のパディング成分を 0 に保つ。
+		演算に通す値のパディング成分は、0 と演算して 0 になり浮動小数点例外を起こさない値（除数なら 1）にする。
+		（レーンマスク形式の Bvec のパディング成分は不定）
+	*/
+	enum {
+		keepsZeroPadding = Traits_t::isPadded && std::is_floating_point_v<Element_t>
+	};
+
+	/* パディング成分が 0 の値のパディング成分を padding にする */
+	template<int padding, typename Intrinsic_t>
+	static inline Intrinsic_t PadOperand(Intrinsic_t simdVec){
+		using SimdVecTraits_t = GenSimdVecTraits<Element_t, Traits_t::memDim>;
+		if constexpr (keepsZeroPadding && padding != 0) {
+			return SimdVecTraits_t::template Blend<(1 << Traits_t::opeDim) - 1>(SimdVecTraits_t::Set1(Element_t(padding)), simdVec);
+		} else {
+			return simdVec;
+		}
+	}
+
+	/* スカラのブロードキャスト（パディング成分は padding にする）*/
+	template<int padding>
+	static inline auto Set1Operand(Element_t param){
+		using SimdVecTraits_t = GenSimdVecTraits<Element_t, Traits_t::memDim>;
+		if constexpr (keepsZeroPadding) {
+			return SimdVecTraits_t::template Blend<(1 << Traits_t::opeDim) - 1>(SimdVecTraits_t::Set1(Element_t(padding)), SimdVecTraits_t::Set1(param));
+		} else {
+			return SimdVecTraits_t::Set1(param);
+		}
+	}
+
+	/* 演算結果のパディング成分を 0 にする */
+	template<typename Intrinsic_t>
+	static inline Intrinsic_t ClearPadding(Intrinsic_t simdVec){
+		using SimdVecTraits_t = GenSimdVecTraits<Element_t, Traits_t::memDim>;
+		if constexpr (keepsZeroPadding) {
+			return SimdVecTraits_t::template Blend<(1 << Traits_t::opeDim) - 1>(SimdVecTraits_t::Set1(Element_t(0)), simdVec);
+		} else {
+			return simdVec;
+		}
+	}
+};
+
+/*
+	パディング付きの型の二項演算で、右辺のパディング成分に置く値（SimdPath::PadOperand を参照）
+	SimdVecTraits_t の関数名に対応付けてマクロから参照する。
+*/
+enum {
+	PaddingOperand_Add = 0,
+	PaddingOperand_Sub = 0,
+	PaddingOperand_Mul = 0,
+	PaddingOperand_Div = 1,
+	PaddingOperand_And = 0,
+	PaddingOperand_Or = 0,
+	PaddingOperand_Xor = 0,
+	PaddingOperand_ShiftLeft = 0,
+	PaddingOperand_ShiftRight = 0,
+	PaddingOperand_LogicalAnd = 0,
+	PaddingOperand_LogicalOr = 0,
+};
+
+/*
+	SIMD 型共通の関数群
+	SimdVecTraits_t が提供する基本演算（Add Mul CmpLt And など）を組み合わせて実装する。
+	SimdVecTraits_t 側で同名の関数を定義すれば、そちらが優先される。
+*/
+template<typename SimdVecTraits_t, typename Element_t, int dim>
+struct GenSimdVecFunctions {
+	/* SIMD レジスタ型 */
+	using Intrinsic_t = typename GenSimdVecType<Element_t, dim>::IntrinsicType_t;
+
+	/* SWIZZLE（成分 i の値を a の成分 (swizzle >> (i * 4)) & 15 から取る）*/
+	template<int swizzle>
+	static inline Intrinsic_t Swizzle(Intrinsic_t a){
+		union {
+			Intrinsic_t simdVec;
+			Element_t elements[dim];
+		} src, dst;
+		src.simdVec = a;
+		for (int i = 0; i < dim; ++i) { dst.elements[i] = src.elements[(swizzle >> (i * 4)) & 15]; }
+		return dst.simdVec;
+	}
+
+	/* 先頭 n 成分の読み込み（残りの成分は 0）*/
+	template<int n>
+	static inline Intrinsic_t LoadPartial(const Element_t *p){
+		union {
+			Intrinsic_t simdVec;
+			Element_t elements[dim];
+		} u;
+		for (int i = 0; i < dim; ++i) { u.elements[i] = (i < n)? p[i] : Element_t(0); }
+		return u.simdVec;
+	}
+
+	/* 先頭 n 成分の書き込み */
+	template<int n>
+	static inline void StorePartial(Element_t *p, Intrinsic_t a){
+		union {
+			Intrinsic_t simdVec;
+			Element_t elements[dim];
+		} u;
+		u.simdVec = a;
+		for (int i = 0; i < n && i < dim; ++i) { p[i] = u.elements[i]; }
+	}
+
+	/* 先頭成分の取り出し */
+	static inline Element_t ExtractFirst(Intrinsic_t a){
+		union {
+			Intrinsic_t simdVec;
+			Element_t elements[dim];
+		} u;
+		u.simdVec = a;
+		return u.elements[0];
+	}
+
+	/*
+		2 入力の SWIZZLE（成分 0 1 は a から、成分 2 3 は b から取る。dim == 4 の場合のみ使用可能）
+		成分 i の取り出し位置は (swizzle >> (i * 4)) & 15。
+	*/
+	template<int swizzle>
+	static inline Intrinsic_t Shuffle(Intrinsic_t a, Intrinsic_t b){
+		return SimdVecTraits_t::template Blend<0xc>(
+			SimdVecTraits_t::template Swizzle<swizzle>(a),
+			SimdVecTraits_t::template Swizzle<swizzle>(b)
+		);
+	}
+
+	/* 全 4 成分の総和を全成分にブロードキャスト（(x + y) + (z + w) の順に加算する）*/
+	static inline Intrinsic_t BroadcastSum4(Intrinsic_t a){
+		Intrinsic_t tmp = SimdVecTraits_t::Add(a, SimdVecTraits_t::template Swizzle<0x2301>(a));
+		return SimdVecTraits_t::Add(tmp, SimdVecTraits_t::template Swizzle<0x1032>(tmp));
+	}
+
+	/*
+		4x4 行列の行列式（aColumn は列。結果は全成分に格納される）
+		列 2 3 から作る 2x2 小行列式と列 1 から余因子を求め、列 0 との内積を取る。
+	*/
+	static inline Intrinsic_t Determinant4x4(const Intrinsic_t aColumn[4]){
+		const Intrinsic_t c2a = SimdVecTraits_t::template Swizzle<0x0001>(aColumn[2]);
+		const Intrinsic_t c2b = SimdVecTraits_t::template Swizzle<0x1122>(aColumn[2]);
+		const Intrinsic_t c2c = SimdVecTraits_t::template Swizzle<0x2333>(aColumn[2]);
+		const Intrinsic_t c3a = SimdVecTraits_t::template Swizzle<0x0001>(aColumn[3]);
+		const Intrinsic_t c3b = SimdVecTraits_t::template Swizzle<0x1122>(aColumn[3]);
+		const Intrinsic_t c3c = SimdVecTraits_t::template Swizzle<0x2333>(aColumn[3]);
+		const Intrinsic_t minor0 = SimdVecTraits_t::Sub(SimdVecTraits_t::Mul(c2b, c3c), SimdVecTraits_t::Mul(c3b, c2c));
+		const Intrinsic_t minor1 = SimdVecTraits_t::Sub(SimdVecTraits_t::Mul(c2a, c3c), SimdVecTraits_t::Mul(c3a, c2c));
+		const Intrinsic_t minor2 = SimdVecTraits_t::Sub(SimdVecTraits_t::Mul(c2a, c3b), SimdVecTraits_t::Mul(c3a, c2b));
+		Intrinsic_t cofactor = SimdVecTraits_t::Add(
+			SimdVecTraits_t::Sub(
+				SimdVecTraits_t::Mul(SimdVecTraits_t::template Swizzle<0x0001>(aColumn[1]), minor0),
+				SimdVecTraits_t::Mul(SimdVecTraits_t::template Swizzle<0x1122>(aColumn[1]), minor1)
+			),
+			SimdVecTraits_t::Mul(SimdVecTraits_t::template Swizzle<0x2333>(aColumn[1]), minor2)
+		);
+		cofactor = SimdVecTraits_t::Xor(
+			cofactor,
+			SimdVecTraits_t::template Blend<0xa>(SimdVecTraits_t::Set1(Element_t(0)), SimdVecTraits_t::Set1(Element_t(-0.0)))
+		);
+		return SimdVecTraits_t::BroadcastSum4(SimdVecTraits_t::Mul(aColumn[0], cofactor));
+	}
+
+	/*
+		4x4 行列の逆行列（aColumn は列。逆行列の列を aResult に格納し、行列式を全成分に持つ値を返す）
+		行列式が 0 の場合、aResult の成分は inf または nan になる。
+	*/
+	static inline Intrinsic_t Inverse4x4(const Intrinsic_t aColumn[4], Intrinsic_t aResult[4]){
+		const Intrinsic_t fac0 = Inverse4x4Factor<3, 2>(aColumn);
+		const Intrinsic_t fac1 = Inverse4x4Factor<3, 1>(aColumn);
+		const Intrinsic_t fac2 = Inverse4x4Factor<2, 1>(aColumn);
+		const Intrinsic_t fac3 = Inverse4x4Factor<3, 0>(aColumn);
+		const Intrinsic_t fac4 = Inverse4x4Factor<2, 0>(aColumn);
+		const Intrinsic_t fac5 = Inverse4x4Factor<1, 0>(aColumn);
+
+		/* (m[1][i], m[0][i], m[0][i], m[0][i]) */
+		const Intrinsic_t vec0 = SimdVecTraits_t::template Swizzle<0x2220>(SimdVecTraits_t::template Shuffle<0x0000>(aColumn[1], aColumn[0]));
+		const Intrinsic_t vec1 = SimdVecTraits_t::template Swizzle<0x2220>(SimdVecTraits_t::template Shuffle<0x1111>(aColumn[1], aColumn[0]));
+		const Intrinsic_t vec2 = SimdVecTraits_t::template Swizzle<0x2220>(SimdVecTraits_t::template Shuffle<0x2222>(aColumn[1], aColumn[0]));
+		const Intrinsic_t vec3 = SimdVecTraits_t::template Swizzle<0x2220>(SimdVecTraits_t::template Shuffle<0x3333>(aColumn[1], aColumn[0]));
+
+		const Intrinsic_t zero = SimdVecTraits_t::Set1(Element_t(0));
+		const Intrinsic_t negZero = SimdVecTraits_t::Set1(Element_t(-0.0));
+		const Intrinsic_t signA = SimdVecTraits_t::template Blend<0xa>(zero, negZero);
+		const Intrinsic_t signB = SimdVecTraits_t::template Blend<0x5>(zero, negZero);
+		const Intrinsic_t inv0 = SimdVecTraits_t::Xor(signA, Inverse4x4Column(vec1, fac0, vec2, fac1, vec3, fac2));
+		const Intrinsic_t inv1 = SimdVecTraits_t::Xor(signB, Inverse4x4Column(vec0, fac0, vec2, fac3, vec3, fac4));
+		const Intrinsic_t inv2 = SimdVecTraits_t::Xor(signA, Inverse4x4Column(vec0, fac1, vec1, fac3, vec3, fac5));
+		const Intrinsic_t inv3 = SimdVecTraits_t::Xor(signB, Inverse4x4Column(vec0, fac2, vec1, fac4, vec2, fac5));
+
+		/* 余因子行列の第 0 行と列 0 の内積が行列式 */
+		const Intrinsic_t row0 = SimdVecTraits_t::template Shuffle<0x2020>(
+			SimdVecTraits_t::template Shuffle<0x0000>(inv0, inv1),
+			SimdVecTraits_t::template Shuffle<0x0000>(inv2, inv3)
+		);
+		const Intrinsic_t det = SimdVecTraits_t::BroadcastSum4(SimdVecTraits_t::Mul(aColumn[0], row0));
+		const Intrinsic_t invDet = SimdVecTraits_t::Div(SimdVecTraits_t::Set1(Element_t(1)), det);
+		aResult[0] = SimdVecTraits_t::Mul(inv0, invDet);
+		aResult[1] = SimdVecTraits_t::Mul(inv1, invDet);
+		aResult[2] = SimdVecTraits_t::Mul(inv2, invDet);
+		aResult[3] = SimdVecTraits_t::Mul(inv3, invDet);
+		return det;
+	}
+
+	/*
+		先頭 3 成分の外積（成分 3 は 0 になるとは限らない。dim == 4 の場合のみ使用可能）
+		a.yzx * b.zxy - a.zxy * b.yzx の 4 回の SWIZZLE を、差を取った後の並べ替えにまとめて 3 回にしている。
+	*/
+	static inline Intrinsic_t Cross3(Intrinsic_t a, Intrinsic_t b){
+		/* (a * b.yzx - a.yzx * b).yzx */
+		Intrinsic_t tmp = SimdVecTraits_t::Sub(
+			SimdVecTraits_t::Mul(a, SimdVecTraits_t::template Swizzle<0x3021>(b)),
+			SimdVecTraits_t::Mul(SimdVecTraits_t::template Swizzle<0x3021>(a), b)
+		);
+		return SimdVecTraits_t::template Swizzle<0x3021>(tmp);
+	}
+
+	/*
+		3x3 行列の行列式（aColumn は成分 3 をパディングとする列。結果は全成分に格納される）
+		列 0 と、列 1 2 の外積との内積を取る。
+	*/
+	static inline Intrinsic_t Determinant3x3(const Intrinsic_t aColumn[3]){
+		return SimdVecTraits_t::template DotBroadcast<3>(aColumn[0], SimdVecTraits_t::Cross3(aColumn[1], aColumn[2]));
+	}
+
+	/*
+		3x3 行列の逆行列（aColumn は成分 3 をパディングとする列。逆行列の列を aResult に格納し、行列式を全成分に持つ値を返す）
+		列の外積が余因子行列の行になるので、それらを転置して行列式で割る。aResult の成分 3 は 0 になる。
+	*/
+	static inline Intrinsic_t Inverse3x3(const Intrinsic_t aColumn[3], Intrinsic_t aResult[3]){
+		Intrinsic_t row0 = SimdVecTraits_t::Cross3(aColumn[1], aColumn[2]);
+		Intrinsic_t row1 = SimdVecTraits_t::Cross3(aColumn[2], aColumn[0]);
+		Intrinsic_t row2 = SimdVecTraits_t::Cross3(aColumn[0], aColumn[1]);
+		Intrinsic_t row3 = SimdVecTraits_t::Set1(Element_t(0));
+		const Intrinsic_t det = SimdVecTraits_t::template DotBroadcast<3>(aColumn[0], row0);
+		const Intrinsic_t invDet = SimdVecTraits_t::Div(SimdVecTraits_t::Set1(Element_t(1)), det);
+		SimdVecTraits_t::Transpose4(row0, row1, row2, row3);
+		aResult[0] = SimdVecTraits_t::Mul(row0, invDet);
+		aResult[1] = SimdVecTraits_t::Mul(row1, invDet);
+		aResult[2] = SimdVecTraits_t::Mul(row2, invDet);
+		return det;
+	}
+
+	/*
+		以下の 2x2 行列の関数は、1 本のレジスタに列 0 列 1 の順で格納された行列 (m00, m01, m10, m11) を扱う。
+		dim == 4 の場合のみ使用可能。
+	*/
+	/* 2x2 行列とベクトルの積（v は成分 0 1 にベクトルを持つ。結果は成分 0 1 に格納される）*/
+	static inline Intrinsic_t Transform2x2(Intrinsic_t m, Intrinsic_t v){
+		/* (m00 x, m01 x, m10 y, m11 y) の上下を足し合わせる */
+		const Intrinsic_t tmp = SimdVecTraits_t::Mul(m, SimdVecTraits_t::template Swizzle<0x1100>(v));
+		return SimdVecTraits_t::Add(tmp, SimdVecTraits_t::template Swizzle<0x3232>(tmp));
+	}
+
+	/* 2x2 行列同士の積 */
+	static inline Intrinsic_t Mul2x2(Intrinsic_t a, Intrinsic_t b){
+		return SimdVecTraits_t::MulAdd(
+			SimdVecTraits_t::template Swizzle<0x1010>(a),
+			SimdVecTraits_t::template Swizzle<0x2200>(b),
+			SimdVecTraits_t::Mul(SimdVecTraits_t::template Swizzle<0x3232>(a), SimdVecTraits_t::template Swizzle<0x3311>(b))
+		);
+	}
+
+	/* 2x2 行列の転置 */
+	static inline Intrinsic_t Transpose2x2(Intrinsic_t a){
+		return SimdVecTraits_t::template Swizzle<0x3120>(a);
+	}
+
+	/* 2x2 行列の行列式（結果は全成分に格納される）*/
+	static inline Intrinsic_t Determinant2x2(Intrinsic_t a){
+		/* (m00 m11, m01 m10, ...) */
+		const Intrinsic_t tmp = SimdVecTraits_t::Mul(a, SimdVecTraits_t::template Swizzle<0x0123>(a));
+		return SimdVecTraits_t::Sub(SimdVecTraits_t::template Swizzle<0x0000>(tmp), SimdVecTraits_t::template Swizzle<0x1111>(tmp));
+	}
+
+	/* 2x2 行列の逆行列（逆行列を rResult に格納し、行列式を全成分に持つ値を返す）*/
+	static inline Intrinsic_t Inverse2x2(Intrinsic_t a, Intrinsic_t &rResult){
+		const Intrinsic_t det = SimdVecTraits_t::Determinant2x2(a);
+		const Intrinsic_t sign = SimdVecTraits_t::template Blend<0x6>(SimdVecTraits_t::Set1(Element_t(0)), SimdVecTraits_t::Set1(Element_t(-0.0)));
+		const Intrinsic_t adj = SimdVecTraits_t::Xor(SimdVecTraits_t::template Swizzle<0x0213>(a), sign);
+		rResult = SimdVecTraits_t::Div(adj, det);
+		return det;
+	}
+
+	/*
+		行ベクトルと列の内積を並べる（dim == 4 の場合のみ使用可能）
+		結果の成分 i は、v と aColumn[i] の先頭 n 成分の内積。成分 nColumn 以上は 0 になる。
+		積を 4x4 転置してから行を足し合わせるので、成分 n 以上の値は結果に混入しない。
+	*/
+	template<int n, int nColumn>
+	static inline Intrinsic_t DotColumns(Intrinsic_t v, const Intrinsic_t aColumn[nColumn]){
+		Intrinsic_t r0, r1, r2, r3;
+		r0 = r1 = r2 = r3 = SimdVecTraits_t::Set1(Element_t(0));
+		if constexpr (nColumn >= 1) { r0 = SimdVecTraits_t::Mul(v, aColumn[0]); }
+		if constexpr (nColumn >= 2) { r1 = SimdVecTraits_t::Mul(v, aColumn[1]); }
+		if constexpr (nColumn >= 3) { r2 = SimdVecTraits_t::Mul(v, aColumn[2]); }
+		if constexpr (nColumn >= 4) { r3 = SimdVecTraits_t::Mul(v, aColumn[3]); }
+		SimdVecTraits_t::Transpose4(r0, r1, r2, r3);
+		if constexpr (n >= 4) {
+			return SimdVecTraits_t::Add(SimdVecTraits_t::Add(r0, r1), SimdVecTraits_t::Add(r2, r3));
+		} else if constexpr (n == 3) {
+			return SimdVecTraits_t::Add(SimdVecTraits_t::Add(r0, r1), r2);
+		} else if constexpr (n == 2) {
+			return SimdVecTraits_t::Add(r0, r1);
+		} else {
+			return r0;
+		}
+	}
+
+	/*
+		以下のアフィン変換の関数は、列 0 1 2 を線形部分、列 3 を平行移動とする 4x3 行列を扱う。
+		各列は成分 3 をパディングとする。dim == 4 の場合のみ使用可能。
+	*/
+	/* 点（isPoint != 0）またはベクトルの変換（v の成分 3 は参照しない）*/
+	template<int isPoint>
+	static inline Intrinsic_t TransformAffine(const Intrinsic_t aColumn[4], Intrinsic_t v){
+		Intrinsic_t tmp = SimdVecTraits_t::Mul(aColumn[0], SimdVecTraits_t::template Swizzle<0x0000>(v));
+		if constexpr (isPoint) {
+			tmp = SimdVecTraits_t::Add(tmp, aColumn[3]);
+		}
+		tmp = SimdVecTraits_t::MulAdd(aColumn[1], SimdVecTraits_t::template Swizzle<0x1111>(v), tmp);
+		return SimdVecTraits_t::MulAdd(aColumn[2], SimdVecTraits_t::template Swizzle<0x2222>(v), tmp);
+	}
+
+	/* アフィン変換の合成 a * b（b を適用してから a を適用する。結果の列を aResult に格納する）*/
+	static inline void ComposeAffine(const Intrinsic_t aColumnA[4], const Intrinsic_t aColumnB[4], Intrinsic_t aResult[4]){
+		aResult[0] = TransformAffine<0>(aColumnA, aColumnB[0]);
+		aResult[1] = TransformAffine<0>(aColumnA, aColumnB[1]);
+		aResult[2] = TransformAffine<0>(aColumnA, aColumnB[2]);
+		aResult[3] = TransformAffine<1>(aColumnA, aColumnB[3]);
+	}
+
+	/*
+		アフィン変換の逆変換（逆変換の列を aResult に格納し、線形部分の行列式を全成分に持つ値を返す）
+		線形部分の逆行列 L' を求め、平行移動を -L' * t とする。
+	*/
+	static inline Intrinsic_t InverseAffine(const Intrinsic_t aColumn[4], Intrinsic_t aResult[4]){
+		const Intrinsic_t det = SimdVecTraits_t::Inverse3x3(aColumn, aResult);
+		aResult[3] = SimdVecTraits_t::Neg(TransformAffine<0>(aResult, aColumn[3]));
+		return det;
+	}
+
+	/*
+		線形部分が正規直交であるアフィン変換の逆変換（逆変換の列を aResult に格納する）
+		線形部分は転置し、平行移動は -transpose(L) * t とする。列 3 も一緒に転置すると、
+		転置後の行 i の成分 3 に t[i] が並ぶので、それをブロードキャストして使う。
+	*/
+	static inline void InverseAffineOrthonormal(const Intrinsic_t aColumn[4], Intrinsic_t aResult[4]){
+		Intrinsic_t r0 = aColumn[0], r1 = aColumn[1], r2 = aColumn[2], r3 = aColumn[3];
+		SimdVecTraits_t::Transpose4(r0, r1, r2, r3);
+		Intrinsic_t tmp = SimdVecTraits_t::Mul(r0, SimdVecTraits_t::template Swizzle<0x3333>(r0));
+		tmp = SimdVecTraits_t::MulAdd(r1, SimdVecTraits_t::template Swizzle<0x3333>(r1), tmp);
+		tmp = SimdVecTraits_t::MulAdd(r2, SimdVecTraits_t::template Swizzle<0x3333>(r2), tmp);
+		aResult[0] = r0;
+		aResult[1] = r1;
+		aResult[2] = r2;
+		aResult[3] = SimdVecTraits_t::Neg(tmp);
+	}
+
+private:
+	/*
+		逆行列計算用の 2x2 小行列式
+		(m[2][q] m[3][p] - m[3][q] m[2][p], 同左, m[1][q] m[3][p] - m[3][q] m[1][p], m[1][q] m[2][p] - m[2][q] m[1][p])
+	*/
+	template<int p, int q>
+	static inline Intrinsic_t Inverse4x4Factor(const Intrinsic_t aColumn[4]){
+		const Intrinsic_t swp0a = SimdVecTraits_t::template Shuffle<p * 0x1111>(aColumn[3], aColumn[2]);
+		const Intrinsic_t swp0b = SimdVecTraits_t::template Shuffle<q * 0x1111>(aColumn[3], aColumn[2]);
+		const Intrinsic_t swp00 = SimdVecTraits_t::template Shuffle<q * 0x1111>(aColumn[2], aColumn[1]);
+		const Intrinsic_t swp03 = SimdVecTraits_t::template Shuffle<p * 0x1111>(aColumn[2], aColumn[1]);
+		const Intrinsic_t swp01 = SimdVecTraits_t::template Swizzle<0x2000>(swp0a);
+		const Intrinsic_t swp02 = SimdVecTraits_t::template Swizzle<0x2000>(swp0b);
+		return SimdVecTraits_t::Sub(SimdVecTraits_t::Mul(swp00, swp01), SimdVecTraits_t::Mul(swp02, swp03));
+	}
+
+	/* 逆行列計算用の余因子 a0 b0 - a1 b1 + a2 b2 */
+	static inline Intrinsic_t Inverse4x4Column(
+		Intrinsic_t a0, Intrinsic_t b0,
+		Intrinsic_t a1, Intrinsic_t b1,
+		Intrinsic_t a2, Intrinsic_t b2
+	){
+		return SimdVecTraits_t::Add(
+			SimdVecTraits_t::Sub(SimdVecTraits_t::Mul(a0, b0), SimdVecTraits_t::Mul(a1, b1)),
+			SimdVecTraits_t::Mul(a2, b2)
+		);
+	}
+
+public:
+
+	/* 定数マスクによる選択（mask のビット i が立っている成分は b、それ以外は a）*/
+	template<int mask>
+	static inline Intrinsic_t Blend(Intrinsic_t a, Intrinsic_t b){
+		union {
+			Intrinsic_t simdVec;
+			Element_t elements[dim];
+		} ua, ub;
+		ua.simdVec = a;
+		ub.simdVec = b;
+		for (int i = 0; i < dim; ++i) { if (mask & (1 << i)) { ua.elements[i] = ub.elements[i]; } }
+		return ua.simdVec;
+	}
+
+	/* 単項演算 */
+	static inline Intrinsic_t Pos(Intrinsic_t a){ return a; }
+	static inline Intrinsic_t Neg(Intrinsic_t a){ return SimdVecTraits_t::Xor(a, SimdVecTraits_t::Set1(Element_t(-0.0))); }
+
+	/* マスクによる選択（mask の立っている成分は a、それ以外は b）*/
+	static inline Intrinsic_t Select(Intrinsic_t mask, Intrinsic_t a, Intrinsic_t b){
+		return SimdVecTraits_t::Or(SimdVecTraits_t::And(mask, a), SimdVecTraits_t::AndNot(mask, b));
+	}
+
+	/* 最近接偶数丸め（|a| < 2^仮数部ビット数 の範囲でのみ加減算で丸める）*/
+	static inline Intrinsic_t RoundEven(Intrinsic_t a){
+		const Intrinsic_t magic = SimdVecTraits_t::Set1(Element_t(sizeof(Element_t) == 4 ? 8388608.0 : 4503599627370496.0));
+		Intrinsic_t absA = Abs(a);
+		Intrinsic_t rounded = SimdVecTraits_t::Sub(SimdVecTraits_t::Add(absA, magic), magic);
+		rounded = SimdVecTraits_t::Or(rounded, SimdVecTraits_t::AndNot(absA, a));
+		return SimdVecTraits_t::Select(SimdVecTraits_t::CmpLt(absA, magic), rounded, a);
+	}
+	static inline Intrinsic_t Floor(Intrinsic_t a){
+		Intrinsic_t rounded = SimdVecTraits_t::RoundEven(a);
+		return SimdVecTraits_t::Sub(rounded, SimdVecTraits_t::And(SimdVecTraits_t::CmpGt(rounded, a), SimdVecTraits_t::Set1(Element_t(1))));
+	}
+	static inline Intrinsic_t Ceil(Intrinsic_t a){
+		Intrinsic_t rounded = SimdVecTraits_t::RoundEven(a);
+		/* -0 を保つため、+1 の加算ではなく -1 の減算とする */
+		return SimdVecTraits_t::Sub(rounded, SimdVecTraits_t::And(SimdVecTraits_t::CmpLt(rounded, a), SimdVecTraits_t::Set1(Element_t(-1))));
+	}
+	static inline Intrinsic_t Trunc(Intrinsic_t a){
+		Intrinsic_t absA = Abs(a);
+		return SimdVecTraits_t::Or(SimdVecTraits_t::Floor(absA), SimdVecTraits_t::AndNot(absA, a));
+	}
+
+	/* 0.5 の端数を 0 から遠い方向へ丸める（std::round 互換）*/
+	static inline Intrinsic_t Round(Intrinsic_t a){
+		const Element_t almostHalf = Element_t(0.5) - std::numeric_limits<Element_t>::epsilon() / 4;
+		Intrinsic_t absA = Abs(a);
+		Intrinsic_t bias = SimdVecTraits_t::Or(SimdVecTraits_t::Set1(almostHalf), SimdVecTraits_t::AndNot(absA, a));
+		return SimdVecTraits_t::Trunc(SimdVecTraits_t::Add(a, bias));
+	}
+
+	/* 要素ごとの関数 */
+	static inline Intrinsic_t Radians(Intrinsic_t a){
+		return SimdVecTraits_t::Div(SimdVecTraits_t::Mul(a, SimdVecTraits_t::Set1(Element_t(/*M_PI*/ 3.14159265358979323846))), SimdVecTraits_t::Set1(Element_t(180)));
+	}
+	static inline Intrinsic_t Degrees(Intrinsic_t a){
+		return SimdVecTraits_t::Div(SimdVecTraits_t::Mul(a, SimdVecTraits_t::Set1(Element_t(180))), SimdVecTraits_t::Set1(Element_t(/*M_PI*/ 3.14159265358979323846)));
+	}
+	static inline Intrinsic_t InvertSqrt(Intrinsic_t a){
+		return SimdVecTraits_t::Sqrt(SimdVecTraits_t::Div(SimdVecTraits_t::Set1(Element_t(1)), a));
+	}
+	static inline Intrinsic_t Abs(Intrinsic_t a){
+		return SimdVecTraits_t::AndNot(SimdVecTraits_t::Set1(Element_t(-0.0)), a);
+	}
+	static inline Intrinsic_t Sign(Intrinsic_t a){
+		Intrinsic_t zero = SimdVecTraits_t::Set1(Element_t(0));
+		return SimdVecTraits_t::Or(
+			SimdVecTraits_t::And(SimdVecTraits_t::CmpGt(a, zero), SimdVecTraits_t::Set1(Element_t( 1))),
+			SimdVecTraits_t::And(SimdVecTraits_t::CmpLt(a, zero), SimdVecTraits_t::Set1(Element_t(-1)))
+		);
+	}
+	static inline Intrinsic_t Fract(Intrinsic_t a){
+		return SimdVecTraits_t::Sub(a, SimdVecTraits_t::Floor(a));
+	}
+	static inline Intrinsic_t Mod(Intrinsic_t a, Intrinsic_t b){
+		return SimdVecTraits_t::Sub(a, SimdVecTraits_t::Mul(b, SimdVecTraits_t::Floor(SimdVecTraits_t::Div(a, b))));
+	}
+	static inline Intrinsic_t Clamp(Intrinsic_t a, Intrinsic_t minVal, Intrinsic_t maxVal){
+		return SimdVecTraits_t::Min(SimdVecTraits_t::Max(a, minVal), maxVal);
+	}
+	static inline Intrinsic_t Mix(Intrinsic_t a, Intrinsic_t b, Intrinsic_t t){
+		return SimdVecTraits_t::Add(a, SimdVecTraits_t::Mul(SimdVecTraits_t::Sub(b, a), t));
+	}
+	static inline Intrinsic_t Step(Intrinsic_t edge, Intrinsic_t a){
+		return SimdVecTraits_t::AndNot(SimdVecTraits_t::CmpLt(a, edge), SimdVecTraits_t::Set1(Element_t(1)));
+	}
+	static inline Intrinsic_t SmoothStep(Intrinsic_t edge0, Intrinsic_t edge1, Intrinsic_t a){
+		Intrinsic_t t = Clamp(
+			SimdVecTraits_t::Div(SimdVecTraits_t::Sub(a, edge0), SimdVecTraits_t::Sub(edge1, edge0)),
+			SimdVecTraits_t::Set1(Element_t(0)),
+			SimdVecTraits_t::Set1(Element_t(1))
+		);
+		return SimdVecTraits_t::Mul(
+			SimdVecTraits_t::Mul(t, t),
+			SimdVecTraits_t::Sub(SimdVecTraits_t::Set1(Element_t(3)), SimdVecTraits_t::Mul(SimdVecTraits_t::Set1(Element_t(2)), t))
+		);
+	}
+
+	/*
+		sin と cos を 1 回の引数還元で同時に求める（有効な成分は先頭 opeDim 成分）
+		x = k * (π/2) + r（|r| <= π/4）とし、π/2 を 4 分割した定数で r を求める（Cody-Waite 法）。
+		k は 1.5 * 2^仮数部ビット数 を足して整数に丸め、そのビット列の下位 2 ビットを象限 k mod 4 として使う。
+		r の多項式近似（Cephes の係数）を 2 つ求め、象限に応じて入れ替えと符号反転をする。
+		還元が正確な範囲は |x| <= 8192（float）、|x| <= 2^28（double）で、
+		戻り値はこの範囲を超える成分（inf を含む）のビットマスク。呼び出し側がその成分だけを標準ライブラリで求め直す。
+		誤差（実測）は float double ともに sin cos で 2.5 ulp 以内、tan（sin / cos）で 4.5 ulp 以内。sin(-0) は +0 になる。
+	*/
+	template<int opeDim>
+	static inline int SinCosReduced(Intrinsic_t a, Intrinsic_t &rSin, Intrinsic_t &rCos){
+		constexpr bool isFloat = (sizeof(Element_t) == 4);
+		constexpr int mantissaBits = isFloat ? 23 : 52;
+		const Intrinsic_t magic = SimdVecTraits_t::Set1(Element_t(isFloat ? 12582912.0 : 6755399441055744.0));
+		const Intrinsic_t kBiased = SimdVecTraits_t::MulAdd(a, SimdVecTraits_t::Set1(Element_t(/* 2/π */ 0.63661977236758134308)), magic);
+		const Intrinsic_t k = SimdVecTraits_t::Sub(kBiased, magic);
+		Intrinsic_t r = a;
+		/*
+			上位 3 項の仮数部は float で 11 ビット以下、double で 25 ビット以下なので、
+			還元範囲内の k との積は丸められない。
+		*/
+		if constexpr (isFloat) {
+			r = SimdVecTraits_t::MulAdd(k, SimdVecTraits_t::Set1(Element_t(-1.5703125)), r);
+			r = SimdVecTraits_t::MulAdd(k, SimdVecTraits_t::Set1(Element_t(-4.837512969970703125e-4)), r);
+			r = SimdVecTraits_t::MulAdd(k, SimdVecTraits_t::Set1(Element_t(-7.549533620476723e-8)), r);
+			r = SimdVecTraits_t::MulAdd(k, SimdVecTraits_t::Set1(Element_t(-2.5633440682570896e-12)), r);
+		} else {
+			r = SimdVecTraits_t::MulAdd(k, SimdVecTraits_t::Set1(Element_t(-1.570796310901641845703e+00)), r);
+			r = SimdVecTraits_t::MulAdd(k, SimdVecTraits_t::Set1(Element_t(-1.589325471229585673427e-08)), r);
+			r = SimdVecTraits_t::MulAdd(k, SimdVecTraits_t::Set1(Element_t(-6.123233932053594251021e-17)), r);
+			r = SimdVecTraits_t::MulAdd(k, SimdVecTraits_t::Set1(Element_t(-6.368317163510949907962e-25)), r);
+		}
+		const Intrinsic_t z = SimdVecTraits_t::Mul(r, r);
+
+		/* sin(r) = r + r * z * ps(z)、cos(r) = 1 - z / 2 + z * z * pc(z) */
+		Intrinsic_t ps, pc;
+		if constexpr (isFloat) {
+			ps = SimdVecTraits_t::Set1(Element_t(-1.9515295891e-4));
+			ps = SimdVecTraits_t::MulAdd(ps, z, SimdVecTraits_t::Set1(Element_t( 8.3321608736e-3)));
+			ps = SimdVecTraits_t::MulAdd(ps, z, SimdVecTraits_t::Set1(Element_t(-1.6666654611e-1)));
+			pc = SimdVecTraits_t::Set1(Element_t( 2.443315711809948e-5));
+			pc = SimdVecTraits_t::MulAdd(pc, z, SimdVecTraits_t::Set1(Element_t(-1.388731625493765e-3)));
+			pc = SimdVecTraits_t::MulAdd(pc, z, SimdVecTraits_t::Set1(Element_t( 4.166664568298827e-2)));
+		} else {
+			ps = SimdVecTraits_t::Set1(Element_t( 1.58962301576546568060e-10));
+			ps = SimdVecTraits_t::MulAdd(ps, z, SimdVecTraits_t::Set1(Element_t(-2.50507477628578072866e-8)));
+			ps = SimdVecTraits_t::MulAdd(ps, z, SimdVecTraits_t::Set1(Element_t( 2.75573136213857245213e-6)));
+			ps = SimdVecTraits_t::MulAdd(ps, z, SimdVecTraits_t::Set1(Element_t(-1.98412698295895385996e-4)));
+			ps = SimdVecTraits_t::MulAdd(ps, z, SimdVecTraits_t::Set1(Element_t( 8.33333333332211858878e-3)));
+			ps = SimdVecTraits_t::MulAdd(ps, z, SimdVecTraits_t::Set1(Element_t(-1.66666666666666307295e-1)));
+			pc = SimdVecTraits_t::Set1(Element_t(-1.13585365213876817300e-11));
+			pc = SimdVecTraits_t::MulAdd(pc, z, SimdVecTraits_t::Set1(Element_t( 2.08757008419747316778e-9)));
+			pc = SimdVecTraits_t::MulAdd(pc, z, SimdVecTraits_t::Set1(Element_t(-2.75573141792967388112e-7)));
+			pc = SimdVecTraits_t::MulAdd(pc, z, SimdVecTraits_t::Set1(Element_t( 2.48015872888517045348e-5)));
+			pc = SimdVecTraits_t::MulAdd(pc, z, SimdVecTraits_t::Set1(Element_t(-1.38888888888730564116e-3)));
+			pc = SimdVecTraits_t::MulAdd(pc, z, SimdVecTraits_t::Set1(Element_t( 4.16666666666665929218e-2)));
+		}
+		const Intrinsic_t sinR = SimdVecTraits_t::MulAdd(SimdVecTraits_t::Mul(r, z), ps, r);
+		const Intrinsic_t cosR = SimdVecTraits_t::MulAdd(
+			SimdVecTraits_t::Mul(z, z), pc,
+			SimdVecTraits_t::MulAdd(z, SimdVecTraits_t::Set1(Element_t(-0.5)), SimdVecTraits_t::Set1(Element_t(1)))
+		);
+
+		/*
+			k が奇数の成分は sin(r) と cos(r) を入れ替える（k の最下位ビットを指数部の最下位ビットへ移し、最小の正規化数と比べる）。
+			sin は k のビット 1、cos は k + 1 のビット 1 を符号ビットへ移して符号を反転する。
+		*/
+		const Intrinsic_t minNormal = SimdVecTraits_t::Set1(std::numeric_limits<Element_t>::min());
+		const Intrinsic_t isOdd = SimdVecTraits_t::CmpEq(SimdVecTraits_t::And(SimdVecTraits_t::template ShiftLeftBits<mantissaBits>(kBiased), minNormal), minNormal);
+		const Intrinsic_t signBit = SimdVecTraits_t::Set1(Element_t(-0.0));
+		const Intrinsic_t sinSign = SimdVecTraits_t::And(SimdVecTraits_t::template ShiftLeftBits<isFloat ? 30 : 62>(kBiased), signBit);
+		const Intrinsic_t cosSign = SimdVecTraits_t::And(
+			SimdVecTraits_t::template ShiftLeftBits<isFloat ? 30 : 62>(SimdVecTraits_t::Add(kBiased, SimdVecTraits_t::Set1(Element_t(1)))), signBit
+		);
+		rSin = SimdVecTraits_t::Xor(SimdVecTraits_t::Select(isOdd, cosR, sinR), sinSign);
+		rCos = SimdVecTraits_t::Xor(SimdVecTraits_t::Select(isOdd, sinR, cosR), cosSign);
+
+		const Intrinsic_t limit = SimdVecTraits_t::Set1(Element_t(isFloat ? 8192.0 : 268435456.0));
+		return SimdVecTraits_t::MoveMask(SimdVecTraits_t::CmpGt(SimdVecTraits_t::Abs(a), limit)) & ((1 << opeDim) - 1);
+	}
+
+	/* bits の立っている成分を func（標準ライブラリの関数）で求め直す */
+	template<typename Func_t>
+	static inline Intrinsic_t RecomputeElements(Intrinsic_t a, Intrinsic_t result, int bits, Func_t func){
+		union {
+			Intrinsic_t simdVec;
+			Element_t elements[dim];
+		} ua, uResult;
+		ua.simdVec = a;
+		uResult.simdVec = result;
+		for (int i = 0; i < dim; ++i) {
+			if (bits & (1 << i)) { uResult.elements[i] = func(ua.elements[i]); }
+		}
+		return uResult.simdVec;
+	}
+
+	template<int opeDim = dim>
+	static inline void SinCos(Intrinsic_t a, Intrinsic_t &rSin, Intrinsic_t &rCos){
+		const int bits = SimdVecTraits_t::template SinCosReduced<opeDim>(a, rSin, rCos);
+		if (bits) {
+			rSin = SimdVecTraits_t::RecomputeElements(a, rSin, bits, [](Element_t x){ return std::sin(x); });
+			rCos = SimdVecTraits_t::RecomputeElements(a, rCos, bits, [](Element_t x){ return std::cos(x); });
+		}
+	}
+
+	/*
+		sin cos の片方だけを求める（有効な成分は先頭 opeDim 成分）
+		sin は x = m * π + r、cos は x = (m + 1/2) * π + r（|r| <= π/2）に還元し、r の奇多項式 1 つで
+		sin(r) を求めて m の偶奇で符号を反転する（象限による入れ替えが無いぶん SinCos より命令数が少ない）。
+		還元には SinCos と同じ π/2 の 4 分割定数を用い、sin(r) の係数は SLEEF のもの。
+		誤差（実測）は float double ともに 2.5 ulp 以内。大きな引数は SinCos と同様に標準ライブラリで求め直す。
+	*/
+	template<int opeDim, bool isCos>
+	static inline Intrinsic_t SinOrCos(Intrinsic_t a){
+		constexpr bool isFloat = (sizeof(Element_t) == 4);
+		const Intrinsic_t magic = SimdVecTraits_t::Set1(Element_t(isFloat ? 12582912.0 : 6755399441055744.0));
+		const Intrinsic_t invPi = SimdVecTraits_t::Set1(Element_t(/* 1/π */ 0.31830988618379067154));
+		Intrinsic_t mBiased;
+		if constexpr (isCos) {
+			mBiased = SimdVecTraits_t::Add(SimdVecTraits_t::MulAdd(a, invPi, SimdVecTraits_t::Set1(Element_t(-0.5))), magic);
+		} else {
+			mBiased = SimdVecTraits_t::MulAdd(a, invPi, magic);
+		}
+		const Intrinsic_t m = SimdVecTraits_t::Sub(mBiased, magic);
+		/* k = 2 * m（sin）、2 * m + 1（cos）*/
+		Intrinsic_t k = SimdVecTraits_t::Add(m, m);
+		if constexpr (isCos) {
+			k = SimdVecTraits_t::Add(k, SimdVecTraits_t::Set1(Element_t(1)));
+		}
+		Intrinsic_t r = a;
+		if constexpr (isFloat) {
+			r = SimdVecTraits_t::MulAdd(k, SimdVecTraits_t::Set1(Element_t(-1.5703125)), r);
+			r = SimdVecTraits_t::MulAdd(k, SimdVecTraits_t::Set1(Element_t(-4.837512969970703125e-4)), r);
+			r = SimdVecTraits_t::MulAdd(k, SimdVecTraits_t::Set1(Element_t(-7.549533620476723e-8)), r);
+			r = SimdVecTraits_t::MulAdd(k, SimdVecTraits_t::Set1(Element_t(-2.5633440682570896e-12)), r);
+		} else {
+			r = SimdVecTraits_t::MulAdd(k, SimdVecTraits_t::Set1(Element_t(-1.570796310901641845703e+00)), r);
+			r = SimdVecTraits_t::MulAdd(k, SimdVecTraits_t::Set1(Element_t(-1.589325471229585673427e-08)), r);
+			r = SimdVecTraits_t::MulAdd(k, SimdVecTraits_t::Set1(Element_t(-6.123233932053594251021e-17)), r);
+			r = SimdVecTraits_t::MulAdd(k, SimdVecTraits_t::Set1(Element_t(-6.368317163510949907962e-25)), r);
+		}
+		const Intrinsic_t z = SimdVecTraits_t::Mul(r, r);
+
+		/* sin(r) = r + r * z * p(z) */
+		Intrinsic_t p;
+		if constexpr (isFloat) {
+			p = SimdVecTraits_t::Set1(Element_t( 2.6083159809786593541503e-6));
+			p = SimdVecTraits_t::MulAdd(p, z, SimdVecTraits_t::Set1(Element_t(-1.981069071916863322258e-4)));
+			p = SimdVecTraits_t::MulAdd(p, z, SimdVecTraits_t::Set1(Element_t( 8.33307858556509017944336e-3)));
+			p = SimdVecTraits_t::MulAdd(p, z, SimdVecTraits_t::Set1(Element_t(-1.66666597127914428710938e-1)));
+		} else {
+			p = SimdVecTraits_t::Set1(Element_t(-7.97255955009037868891952e-18));
+			p = SimdVecTraits_t::MulAdd(p, z, SimdVecTraits_t::Set1(Element_t( 2.81009972710863200091251e-15)));
+			p = SimdVecTraits_t::MulAdd(p, z, SimdVecTraits_t::Set1(Element_t(-7.64712219118158833288484e-13)));
+			p = SimdVecTraits_t::MulAdd(p, z, SimdVecTraits_t::Set1(Element_t( 1.60590430605664501629054e-10)));
+			p = SimdVecTraits_t::MulAdd(p, z, SimdVecTraits_t::Set1(Element_t(-2.50521083763502045810755e-8)));
+			p = SimdVecTraits_t::MulAdd(p, z, SimdVecTraits_t::Set1(Element_t( 2.75573192239198747630416e-6)));
+			p = SimdVecTraits_t::MulAdd(p, z, SimdVecTraits_t::Set1(Element_t(-1.98412698412696162806809e-4)));
+			p = SimdVecTraits_t::MulAdd(p, z, SimdVecTraits_t::Set1(Element_t( 8.33333333333332974823815e-3)));
+			p = SimdVecTraits_t::MulAdd(p, z, SimdVecTraits_t::Set1(Element_t(-1.66666666666666657414808e-1)));
+		}
+		const Intrinsic_t sinR = SimdVecTraits_t::MulAdd(SimdVecTraits_t::Mul(r, z), p, r);
+
+		/* sin は m、cos は m + 1 の最下位ビットを符号ビットへ移して符号を反転する */
+		constexpr int toSign = isFloat ? 31 : 63;
+		Intrinsic_t result;
+		if constexpr (isCos) {
+			result = SimdVecTraits_t::Xor(sinR, SimdVecTraits_t::template ShiftLeftBits<toSign>(SimdVecTraits_t::Add(mBiased, SimdVecTraits_t::Set1(Element_t(1)))));
+		} else {
+			result = SimdVecTraits_t::Xor(sinR, SimdVecTraits_t::template ShiftLeftBits<toSign>(mBiased));
+		}
+
+		const Intrinsic_t limit = SimdVecTraits_t::Set1(Element_t(isFloat ? 8192.0 : 268435456.0));
+		const int bits = SimdVecTraits_t::MoveMask(SimdVecTraits_t::CmpGt(SimdVecTraits_t::Abs(a), limit)) & ((1 << opeDim) - 1);
+		if (bits) {
+			if constexpr (isCos) {
+				result = SimdVecTraits_t::RecomputeElements(a, result, bits, [](Element_t x){ return std::cos(x); });
+			} else {
+				result = SimdVecTraits_t::RecomputeElements(a, result, bits, [](Element_t x){ return std::sin(x); });
+			}
+		}
+		return result;
+	}
+	template<int opeDim = dim>
+	static inline Intrinsic_t Sin(Intrinsic_t a){
+		return SimdVecTraits_t::template SinOrCos<opeDim, false>(a);
+	}
+	template<int opeDim = dim>
+	static inline Intrinsic_t Cos(Intrinsic_t a){
+		return SimdVecTraits_t::template SinOrCos<opeDim, true>(a);
+	}
+	template<int opeDim = dim>
+	static inline Intrinsic_t Tan(Intrinsic_t a){
+		Intrinsic_t sinA, cosA;
+		const int bits = SimdVecTraits_t::template SinCosReduced<opeDim>(a, sinA, cosA);
+		Intrinsic_t tanA = SimdVecTraits_t::Div(sinA, cosA);
+		if (bits) { tanA = SimdVecTraits_t::RecomputeElements(a, tanA, bits, [](Element_t x){ return std::tan(x); }); }
+		return tanA;
+	}
+
+	/* 成分ごとのビット列の論理シフト */
+	template<int n>
+	static inline Intrinsic_t ShiftLeftBits(Intrinsic_t a){
+		using Bits_t = std::conditional_t<sizeof(Element_t) == 4, std::uint32_t, std::uint64_t>;
+		union {
+			Intrinsic_t simdVec;
+			Bits_t bits[dim];
+		} u;
+		u.simdVec = a;
+		for (int i = 0; i < dim; ++i) { u.bits[i] <<= n; }
+		return u.simdVec;
+	}
+	template<int n>
+	static inline Intrinsic_t ShiftRightBits(Intrinsic_t a){
+		using Bits_t = std::conditional_t<sizeof(Element_t) == 4, std::uint32_t, std::uint64_t>;
+		union {
+			Intrinsic_t simdVec;
+			Bits_t bits[dim];
+		} u;
+		u.simdVec = a;
+		for (int i = 0; i < dim; ++i) { u.bits[i] >>= n; }
+		return u.simdVec;
+	}
+
+	/*
+		a * 2^n（n は整数値）
+		2^n は n + バイアス + 2^仮数部ビット数 の下位ビットを指数部の位置へシフトして作る。
+		結果が非正規化数になる場合も扱えるよう 2 回に分けて乗算する（|n| <= 2 * 最大指数 の範囲で有効）。
+	*/
+	static inline Intrinsic_t Ldexp(Intrinsic_t a, Intrinsic_t n){
+		constexpr bool isFloat = (sizeof(Element_t) == 4);
+		constexpr int mantissaBits = isFloat ? 23 : 52;
+		const Intrinsic_t offset = SimdVecTraits_t::Set1(Element_t(isFloat ? 8388608.0 + 127.0 : 4503599627370496.0 + 1023.0));
+		const Intrinsic_t n0 = SimdVecTraits_t::Floor(SimdVecTraits_t::Mul(n, SimdVecTraits_t::Set1(Element_t(0.5))));
+		const Intrinsic_t n1 = SimdVecTraits_t::Sub(n, n0);
+		const Intrinsic_t scale0 = SimdVecTraits_t::template ShiftLeftBits<mantissaBits>(SimdVecTraits_t::Add(n0, offset));
+		const Intrinsic_t scale1 = SimdVecTraits_t::template ShiftLeftBits<mantissaBits>(SimdVecTraits_t::Add(n1, offset));
+		return SimdVecTraits_t::Mul(SimdVecTraits_t::Mul(a, scale0), scale1);
+	}
+
+	/*
+		a = m * 2^e（0.5 <= m < 1）に分解して m を返す（a は正の正規化数に限る）
+		指数部を仮数部の位置へシフトし、2^仮数部ビット数 の下位ビットとして数値化する。
+	*/
+	static inline Intrinsic_t Frexp(Intrinsic_t a, Intrinsic_t &rExponent){
+		constexpr bool isFloat = (sizeof(Element_t) == 4);
+		constexpr int mantissaBits = isFloat ? 23 : 52;
+		const Intrinsic_t magic = SimdVecTraits_t::Set1(Element_t(isFloat ? 8388608.0 : 4503599627370496.0));
+		rExponent = SimdVecTraits_t::Sub(
+			SimdVecTraits_t::Or(SimdVecTraits_t::template ShiftRightBits<mantissaBits>(a), magic),
+			SimdVecTraits_t::Set1(Element_t(isFloat ? 8388608.0 + 126.0 : 4503599627370496.0 + 1022.0))
+		);
+		/* -inf のビット列は符号と指数部のマスク */
+		return SimdVecTraits_t::Or(
+			SimdVecTraits_t::AndNot(SimdVecTraits_t::Set1(-std::numeric_limits<Element_t>::infinity()), a),
+			SimdVecTraits_t::Set1(Element_t(0.5))
+		);
+	}
+
+	/*
+		指数関数 exp exp2 の共通部分
+		x = n * log(2) + r（exp2 は x = n + r）に還元し、2^r の近似（Cephes の係数）を返す。
+		n は 1.5 * 2^仮数部ビット数 を足して整数に丸め、足したままの値を rBiasedN に返す（仮数部の下位ビットが n になる）。
+	*/
+	template<bool isExp2>
+	static inline Intrinsic_t ExpReduce(Intrinsic_t x, Intrinsic_t &rBiasedN){
+		constexpr bool isFloat = (sizeof(Element_t) == 4);
+		const Intrinsic_t magic = SimdVecTraits_t::Set1(Element_t(isFloat ? 12582912.0 : 6755399441055744.0));
+		Intrinsic_t y;
+		if constexpr (isExp2) {
+			rBiasedN = SimdVecTraits_t::Add(x, magic);
+			const Intrinsic_t r = SimdVecTraits_t::Sub(x, SimdVecTraits_t::Sub(rBiasedN, magic));
+			if constexpr (isFloat) {
+				/* 2^r = 1 + r * p(r) */
+				Intrinsic_t p = SimdVecTraits_t::Set1(Element_t(1.535336188319500e-4));
+				p = SimdVecTraits_t::MulAdd(p, r, SimdVecTraits_t::Set1(Element_t(1.339887440266574e-3)));
+				p = SimdVecTraits_t::MulAdd(p, r, SimdVecTraits_t::Set1(Element_t(9.618437357674640e-3)));
+				p = SimdVecTraits_t::MulAdd(p, r, SimdVecTraits_t::Set1(Element_t(5.550332471162809e-2)));
+				p = SimdVecTraits_t::MulAdd(p, r, SimdVecTraits_t::Set1(Element_t(2.402264791363012e-1)));
+				p = SimdVecTraits_t::MulAdd(p, r, SimdVecTraits_t::Set1(Element_t(6.931472028550421e-1)));
+				y = SimdVecTraits_t::MulAdd(r, p, SimdVecTraits_t::Set1(Element_t(1)));
+			} else {
+				/* 2^r = 1 + 2 * r P(r^2) / (Q(r^2) - r P(r^2)) */
+				const Intrinsic_t rr = SimdVecTraits_t::Mul(r, r);
+				Intrinsic_t p = SimdVecTraits_t::Set1(Element_t(2.30933477057345225087e-2));
+				p = SimdVecTraits_t::MulAdd(p, rr, SimdVecTraits_t::Set1(Element_t(2.02020656693165307700e1)));
+				p = SimdVecTraits_t::MulAdd(p, rr, SimdVecTraits_t::Set1(Element_t(1.51390680115615096133e3)));
+				p = SimdVecTraits_t::Mul(p, r);
+				Intrinsic_t q = SimdVecTraits_t::Add(rr, SimdVecTraits_t::Set1(Element_t(2.33184211722314911771e2)));
+				q = SimdVecTraits_t::MulAdd(q, rr, SimdVecTraits_t::Set1(Element_t(4.36821166879210612817e3)));
+				y = SimdVecTraits_t::Div(p, SimdVecTraits_t::Sub(q, p));
+				y = SimdVecTraits_t::MulAdd(y, SimdVecTraits_t::Set1(Element_t(2)), SimdVecTraits_t::Set1(Element_t(1)));
+			}
+		} else {
+			rBiasedN = SimdVecTraits_t::MulAdd(x, SimdVecTraits_t::Set1(Element_t(/* log2(e) */ 1.44269504088896340736)), magic);
+			const Intrinsic_t n = SimdVecTraits_t::Sub(rBiasedN, magic);
+			Intrinsic_t r = x;
+			r = SimdVecTraits_t::MulAdd(n, SimdVecTraits_t::Set1(Element_t(isFloat ? -0.693359375 : -6.93145751953125e-1)), r);
+			r = SimdVecTraits_t::MulAdd(n, SimdVecTraits_t::Set1(Element_t(isFloat ? 2.12194440e-4 : -1.42860682030941723212e-6)), r);
+			if constexpr (isFloat) {
+				/* e^r = 1 + r + r^2 * p(r) */
+				Intrinsic_t p = SimdVecTraits_t::Set1(Element_t(1.9875691500e-4));
+				p = SimdVecTraits_t::MulAdd(p, r, SimdVecTraits_t::Set1(Element_t(1.3981999507e-3)));
+				p = SimdVecTraits_t::MulAdd(p, r, SimdVecTraits_t::Set1(Element_t(8.3334519073e-3)));
+				p = SimdVecTraits_t::MulAdd(p, r, SimdVecTraits_t::Set1(Element_t(4.1665795894e-2)));
+				p = SimdVecTraits_t::MulAdd(p, r, SimdVecTraits_t::Set1(Element_t(1.6666665459e-1)));
+				p = SimdVecTraits_t::MulAdd(p, r, SimdVecTraits_t::Set1(Element_t(5.0000001201e-1)));
+				y = SimdVecTraits_t::Add(SimdVecTraits_t::MulAdd(SimdVecTraits_t::Mul(r, r), p, r), SimdVecTraits_t::Set1(Element_t(1)));
+			} else {
+				/* e^r = 1 + 2 * r P(r^2) / (Q(r^2) - r P(r^2)) */
+				const Intrinsic_t rr = SimdVecTraits_t::Mul(r, r);
+				Intrinsic_t p = SimdVecTraits_t::Set1(Element_t(1.26177193074810590878e-4));
+				p = SimdVecTraits_t::MulAdd(p, rr, SimdVecTraits_t::Set1(Element_t(3.02994407707441961300e-2)));
+				p = SimdVecTraits_t::MulAdd(p, rr, SimdVecTraits_t::Set1(Element_t(9.99999999999999999910e-1)));
+				p = SimdVecTraits_t::Mul(p, r);
+				Intrinsic_t q = SimdVecTraits_t::Set1(Element_t(3.00198505138664455042e-6));
+				q = SimdVecTraits_t::MulAdd(q, rr, SimdVecTraits_t::Set1(Element_t(2.52448340349684104192e-3)));
+				q = SimdVecTraits_t::MulAdd(q, rr, SimdVecTraits_t::Set1(Element_t(2.27265548208155028766e-1)));
+				q = SimdVecTraits_t::MulAdd(q, rr, SimdVecTraits_t::Set1(Element_t(2.00000000000000000009e0)));
+				y = SimdVecTraits_t::Div(p, SimdVecTraits_t::Sub(q, p));
+				y = SimdVecTraits_t::MulAdd(y, SimdVecTraits_t::Set1(Element_t(2)), SimdVecTraits_t::Set1(Element_t(1)));
+			}
+		}
+		return y;
+	}
+
+	/*
+		指数関数 exp exp2（有効な成分は先頭 opeDim 成分）
+		ExpReduce の結果に 2^n を掛ける。2^n は n + バイアス を仮数部の下位ビットに持つ値を指数部の位置へシフトして作る。
+		2^n が正規化数にならない成分（|x| が exp で 87 と 708、exp2 で 126 と 1022（float と double）を超える）があれば、
+		引数を範囲外で 0 または inf になる値に丸め、Ldexp で 2 回に分けて掛ける（NaN は保つ）。
+		誤差（実測）は float double ともに 1.6 ulp 以内。
+	*/
+	template<int opeDim, bool isExp2>
+	static inline Intrinsic_t ExpCommon(Intrinsic_t a){
+		constexpr bool isFloat = (sizeof(Element_t) == 4);
+		constexpr int mantissaBits = isFloat ? 23 : 52;
+		const Intrinsic_t limit = SimdVecTraits_t::Set1(Element_t(isExp2 ? (isFloat ? 126.0 : 1022.0) : (isFloat ? 87.0 : 708.0)));
+		Intrinsic_t biasedN;
+		if (SimdVecTraits_t::MoveMask(SimdVecTraits_t::CmpGt(SimdVecTraits_t::Abs(a), limit)) & ((1 << opeDim) - 1)) {
+			/* 定数を第 1 引数とし、NaN を第 2 引数の側から伝える */
+			const Intrinsic_t x = SimdVecTraits_t::Min(
+				SimdVecTraits_t::Set1(Element_t(isExp2 ? (isFloat ? 129.0 : 1025.0) : (isFloat ? 89.0 : 710.0))),
+				SimdVecTraits_t::Max(SimdVecTraits_t::Set1(Element_t(isExp2 ? (isFloat ? -151.0 : -1076.0) : (isFloat ? -104.0 : -746.0))), a)
+			);
+			const Intrinsic_t y = SimdVecTraits_t::template ExpReduce<isExp2>(x, biasedN);
+			const Intrinsic_t magic = SimdVecTraits_t::Set1(Element_t(isFloat ? 12582912.0 : 6755399441055744.0));
+			return SimdVecTraits_t::Ldexp(y, SimdVecTraits_t::Sub(biasedN, magic));
+		}
+		const Intrinsic_t y = SimdVecTraits_t::template ExpReduce<isExp2>(a, biasedN);
+		const Intrinsic_t bias = SimdVecTraits_t::Set1(Element_t(isFloat ? 127.0 : 1023.0));
+		return SimdVecTraits_t::Mul(y, SimdVecTraits_t::template ShiftLeftBits<mantissaBits>(SimdVecTraits_t::Add(biasedN, bias)));
+	}
+	template<int opeDim = dim>
+	static inline Intrinsic_t Exp(Intrinsic_t a){
+		return SimdVecTraits_t::template ExpCommon<opeDim, false>(a);
+	}
+	template<int opeDim = dim>
+	static inline Intrinsic_t Exp2(Intrinsic_t a){
+		return SimdVecTraits_t::template ExpCommon<opeDim, true>(a);
+	}
+
+	/*
+		対数関数 log log2 の共通部分（有効な成分は先頭 opeDim 成分）
+		a = 2^e * (1 + x)（sqrt(0.5) <= 1 + x < sqrt(2)）に還元し、log(1 + x) = x + 戻り値 となる値を求める。
+		有効な成分に正の正規化数以外（非正規化数 0 負数 inf NaN）があれば rIsSpecial を true にし、
+		非正規化数は 2^(仮数部ビット数 + 1) 倍してから分解する（それ以外の成分は呼び出し側が LogSpecialCases で置き換える）。
+	*/
+	template<int opeDim>
+	static inline Intrinsic_t LogReduce(Intrinsic_t a, Intrinsic_t &rX, Intrinsic_t &rExponent, bool &rIsSpecial){
+		constexpr bool isFloat = (sizeof(Element_t) == 4);
+		const Intrinsic_t one = SimdVecTraits_t::Set1(Element_t(1));
+		const Intrinsic_t minNormal = SimdVecTraits_t::Set1(std::numeric_limits<Element_t>::min());
+		const Intrinsic_t isNormal = SimdVecTraits_t::And(
+			SimdVecTraits_t::CmpGe(a, minNormal),
+			SimdVecTraits_t::CmpLt(a, SimdVecTraits_t::Set1(std::numeric_limits<Element_t>::infinity()))
+		);
+		rIsSpecial = (~SimdVecTraits_t::MoveMask(isNormal) & ((1 << opeDim) - 1)) != 0;
+		Intrinsic_t m;
+		if (rIsSpecial) {
+			const Intrinsic_t isDenormal = SimdVecTraits_t::CmpLt(a, minNormal);
+			m = SimdVecTraits_t::Frexp(
+				SimdVecTraits_t::Select(isDenormal, SimdVecTraits_t::Mul(a, SimdVecTraits_t::Set1(Element_t(isFloat ? 16777216.0 : 18014398509481984.0))), a),
+				rExponent
+			);
+			rExponent = SimdVecTraits_t::Sub(rExponent, SimdVecTraits_t::And(isDenormal, SimdVecTraits_t::Set1(Element_t(isFloat ? 24.0 : 54.0))));
+		} else {
+			m = SimdVecTraits_t::Frexp(a, rExponent);
+		}
+		const Intrinsic_t isSmall = SimdVecTraits_t::CmpLt(m, SimdVecTraits_t::Set1(Element_t(/* sqrt(0.5) */ 0.70710678118654752440)));
+		rExponent = SimdVecTraits_t::Sub(rExponent, SimdVecTraits_t::And(isSmall, one));
+		const Intrinsic_t x = SimdVecTraits_t::Sub(SimdVecTraits_t::Add(m, SimdVecTraits_t::And(isSmall, m)), one);
+		const Intrinsic_t z = SimdVecTraits_t::Mul(x, x);
+		Intrinsic_t y;
+		if constexpr (isFloat) {
+			/*
+				log(1 + x) = x - x^2 / 2 + x^3 * p(x)
+				8 次の p(x) は依存の連鎖を短くするため、x^2 と x^4 で項をまとめて求める（Estrin 法）。
+			*/
+			const Intrinsic_t z2 = SimdVecTraits_t::Mul(z, z);
+			const Intrinsic_t p01 = SimdVecTraits_t::MulAdd(SimdVecTraits_t::Set1(Element_t(-2.4999993993e-1)), x, SimdVecTraits_t::Set1(Element_t( 3.3333331174e-1)));
+			const Intrinsic_t p23 = SimdVecTraits_t::MulAdd(SimdVecTraits_t::Set1(Element_t(-1.6668057665e-1)), x, SimdVecTraits_t::Set1(Element_t( 2.0000714765e-1)));
+			const Intrinsic_t p45 = SimdVecTraits_t::MulAdd(SimdVecTraits_t::Set1(Element_t(-1.2420140846e-1)), x, SimdVecTraits_t::Set1(Element_t( 1.4249322787e-1)));
+			const Intrinsic_t p67 = SimdVecTraits_t::MulAdd(SimdVecTraits_t::Set1(Element_t(-1.1514610310e-1)), x, SimdVecTraits_t::Set1(Element_t( 1.1676998740e-1)));
+			const Intrinsic_t p03 = SimdVecTraits_t::MulAdd(p23, z, p01);
+			const Intrinsic_t p48 = SimdVecTraits_t::MulAdd(SimdVecTraits_t::MulAdd(SimdVecTraits_t::Set1(Element_t(7.0376836292e-2)), z, p67), z, p45);
+			const Intrinsic_t p = SimdVecTraits_t::MulAdd(p48, z2, p03);
+			y = SimdVecTraits_t::Mul(SimdVecTraits_t::Mul(x, z), p);
+		} else {
+			/* log(1 + x) = x - x^2 / 2 + x^3 * P(x) / Q(x) */
+			Intrinsic_t p = SimdVecTraits_t::Set1(Element_t(1.01875663804580931796e-4));
+			p = SimdVecTraits_t::MulAdd(p, x, SimdVecTraits_t::Set1(Element_t(4.97494994976747001425e-1)));
+			p = SimdVecTraits_t::MulAdd(p, x, SimdVecTraits_t::Set1(Element_t(4.70579119878881725854e0)));
+			p = SimdVecTraits_t::MulAdd(p, x, SimdVecTraits_t::Set1(Element_t(1.44989225341610930846e1)));
+			p = SimdVecTraits_t::MulAdd(p, x, SimdVecTraits_t::Set1(Element_t(1.79368678507819816313e1)));
+			p = SimdVecTraits_t::MulAdd(p, x, SimdVecTraits_t::Set1(Element_t(7.70838733755885391666e0)));
+			Intrinsic_t q = SimdVecTraits_t::Add(x, SimdVecTraits_t::Set1(Element_t(1.12873587189167450590e1)));
+			q = SimdVecTraits_t::MulAdd(q, x, SimdVecTraits_t::Set1(Element_t(4.52279145837532221105e1)));
+			q = SimdVecTraits_t::MulAdd(q, x, SimdVecTraits_t::Set1(Element_t(8.29875266912776603211e1)));
+			q = SimdVecTraits_t::MulAdd(q, x, SimdVecTraits_t::Set1(Element_t(7.11544750618563894466e1)));
+			q = SimdVecTraits_t::MulAdd(q, x, SimdVecTraits_t::Set1(Element_t(2.31251620126765340583e1)));
+			y = SimdVecTraits_t::Mul(SimdVecTraits_t::Mul(x, z), SimdVecTraits_t::Div(p, q));
+		}
+		rX = x;
+		return SimdVecTraits_t::MulAdd(z, SimdVecTraits_t::Set1(Element_t(-0.5)), y);
+	}
+
+	/* 対数関数の特殊値（0 は -inf、負数と NaN は NaN、inf は inf）*/
+	static inline Intrinsic_t LogSpecialCases(Intrinsic_t a, Intrinsic_t result){
+		const Intrinsic_t zero = SimdVecTraits_t::Set1(Element_t(0));
+		const Intrinsic_t inf = SimdVecTraits_t::Set1(std::numeric_limits<Element_t>::infinity());
+		result = SimdVecTraits_t::Select(SimdVecTraits_t::CmpEq(a, inf), inf, result);
+		return SimdVecTraits_t::Select(
+			SimdVecTraits_t::CmpGt(a, zero),
+			result,
+			SimdVecTraits_t::Select(
+				SimdVecTraits_t::CmpEq(a, zero),
+				SimdVecTraits_t::Set1(-std::numeric_limits<Element_t>::infinity()),
+				SimdVecTraits_t::Set1(std::numeric_limits<Element_t>::quiet_NaN())
+			)
+		);
+	}
+
+	/*
+		対数関数 log log2
+		log2(e) と log(2) は上位と下位に分けて掛け、丸め誤差を抑える。
+		誤差（実測）は float double ともに 1.5 ulp 以内。
+	*/
+	template<int opeDim = dim>
+	static inline Intrinsic_t Log(Intrinsic_t a){
+		Intrinsic_t x, e;
+		bool isSpecial;
+		const Intrinsic_t y = SimdVecTraits_t::template LogReduce<opeDim>(a, x, e, isSpecial);
+		Intrinsic_t result = SimdVecTraits_t::MulAdd(e, SimdVecTraits_t::Set1(Element_t(-2.121944400546905827679e-4)), y);
+		result = SimdVecTraits_t::Add(result, x);
+		result = SimdVecTraits_t::MulAdd(e, SimdVecTraits_t::Set1(Element_t(0.693359375)), result);
+		return isSpecial ? SimdVecTraits_t::LogSpecialCases(a, result) : result;
+	}
+	template<int opeDim = dim>
+	static inline Intrinsic_t Log2(Intrinsic_t a){
+		Intrinsic_t x, e;
+		bool isSpecial;
+		const Intrinsic_t y = SimdVecTraits_t::template LogReduce<opeDim>(a, x, e, isSpecial);
+		/* log2(e) - 1 */
+		const Intrinsic_t log2eMinus1 = SimdVecTraits_t::Set1(Element_t(4.4269504088896340735992e-1));
+		Intrinsic_t result = SimdVecTraits_t::Mul(y, log2eMinus1);
+		result = SimdVecTraits_t::MulAdd(x, log2eMinus1, result);
+		result = SimdVecTraits_t::Add(result, y);
+		result = SimdVecTraits_t::Add(result, x);
+		result = SimdVecTraits_t::Add(result, e);
+		return isSpecial ? SimdVecTraits_t::LogSpecialCases(a, result) : result;
+	}
+
+	/*
+		累乗 pow（exp2(b * log2(|a|)) として求める）
+		GLSL の精度規定と同じく誤差は |b * log2(a)| に比例して増える（|b * log2(a)| が 20 程度で 20 ulp 程度）。
+		std::pow に合わせ、b が 0 の成分は 1、|a| が 1 の成分は符号を除いて 1、
+		a が負で b が整数の成分は符号を補い、a が負で b が整数でない成分は NaN とする。
+	*/
+	template<int opeDim = dim>
+	static inline Intrinsic_t Pow(Intrinsic_t a, Intrinsic_t b){
+		const Intrinsic_t zero = SimdVecTraits_t::Set1(Element_t(0));
+		const Intrinsic_t one = SimdVecTraits_t::Set1(Element_t(1));
+		const Intrinsic_t halfB = SimdVecTraits_t::Mul(b, SimdVecTraits_t::Set1(Element_t(0.5)));
+		const Intrinsic_t isInteger = SimdVecTraits_t::CmpEq(SimdVecTraits_t::RoundEven(b), b);
+		const Intrinsic_t isOdd = SimdVecTraits_t::AndNot(SimdVecTraits_t::CmpEq(SimdVecTraits_t::RoundEven(halfB), halfB), isInteger);
+		const Intrinsic_t absA = SimdVecTraits_t::Abs(a);
+		Intrinsic_t result = SimdVecTraits_t::template Exp2<opeDim>(SimdVecTraits_t::Mul(b, SimdVecTraits_t::template Log2<opeDim>(absA)));
+		result = SimdVecTraits_t::Select(SimdVecTraits_t::CmpEq(absA, one), one, result);
+		result = SimdVecTraits_t::Xor(result, SimdVecTraits_t::And(SimdVecTraits_t::And(a, SimdVecTraits_t::Set1(Element_t(-0.0))), isOdd));
+		result = SimdVecTraits_t::Select(
+			SimdVecTraits_t::AndNot(isInteger, SimdVecTraits_t::CmpLt(a, zero)),
+			SimdVecTraits_t::Set1(std::numeric_limits<Element_t>::quiet_NaN()),
+			result
+		);
+		return SimdVecTraits_t::Select(SimdVecTraits_t::CmpEq(b, zero), one, result);
+	}
+
+	/*
+		コンパイル時定数の指数 numerator / denominator による累乗
+		整数指数は 2 乗の繰り返し、分母が 2 と 4 の場合は sqrt を経由し、
+		それ以外は Pow（GLSLMATH_USE_SIMD_TRANSCENDENTAL が 0 なら成分ごとの std::pow）を用いる。
+	*/
+	template<int numerator, int denominator>
+	static inline Intrinsic_t PowConst(Intrinsic_t a){
+		static_assert(denominator > 0);
+		if constexpr (numerator < 0) {
+			return SimdVecTraits_t::Div(SimdVecTraits_t::Set1(Element_t(1)), SimdVecTraits_t::template PowConst<-numerator, denominator>(a));
+		} else if constexpr (denominator == 1) {
+			if constexpr (numerator == 0) {
+				return SimdVecTraits_t::Set1(Element_t(1));
+			} else if constexpr (numerator == 1) {
+				return a;
+			} else {
+				const Intrinsic_t half = SimdVecTraits_t::template PowConst<numerator / 2, 1>(a);
+				const Intrinsic_t square = SimdVecTraits_t::Mul(half, half);
+				if constexpr (numerator % 2 == 0) {
+					return square;
+				} else {
+					return SimdVecTraits_t::Mul(square, a);
+				}
+			}
+		} else if constexpr (numerator % denominator == 0) {
+			return SimdVecTraits_t::template PowConst<numerator / denominator, 1>(a);
+		} else if constexpr (denominator == 2) {
+			return SimdVecTraits_t::template PowConst<numerator, 1>(SimdVecTraits_t::Sqrt(a));
+		} else if constexpr (denominator == 4) {
+			return SimdVecTraits_t::template PowConst<numerator, 1>(SimdVecTraits_t::Sqrt(SimdVecTraits_t::Sqrt(a)));
+		} else if constexpr (GLSLMATH_USE_SIMD_TRANSCENDENTAL) {
+			return SimdVecTraits_t::Pow(a, SimdVecTraits_t::Set1(Element_t(numerator) / Element_t(denominator)));
+		} else {
+			return SimdVecTraits_t::RecomputeElements(a, a, (1 << dim) - 1, [](Element_t x){ return std::pow(x, Element_t(numerator) / Element_t(denominator)); });
+		}
+	}
+
+	/*
+		先頭 n 成分の内積を全成分にブロードキャスト
+		成分 n 以上の積は 0 に置き換えてから、(x + y) + (z + w) の順に加算する。
+		（スカラの経路は添字順に加算するので、丸め誤差の分だけ結果が異なることがある）
+	*/
+	template<int n>
+	static inline Intrinsic_t DotBroadcast(Intrinsic_t a, Intrinsic_t b){
+		Intrinsic_t tmp = SimdVecTraits_t::Mul(a, b);
+		if constexpr (n < dim) {
+			tmp = SimdVecTraits_t::template Blend<((1 << dim) - 1) & ~((1 << n) - 1)>(tmp, SimdVecTraits_t::Set1(Element_t(0)));
+		}
+		if constexpr (dim == 4) {
+			return SimdVecTraits_t::BroadcastSum4(tmp);
+		} else {
+			static_assert(dim == 2);
+			return SimdVecTraits_t::Add(tmp, SimdVecTraits_t::template Swizzle<0x01>(tmp));
+		}
+	}
+
+	/* 先頭 n 成分の内積 */
+	template<int n>
+	static inline Element_t Dot(Intrinsic_t a, Intrinsic_t b){
+		return SimdVecTraits_t::ExtractFirst(SimdVecTraits_t::template DotBroadcast<n>(a, b));
+	}
+
+	/* 融合積和（FMA 命令が無い場合は成分ごとに std::fma を呼ぶ）*/
+	static inline Intrinsic_t FusedMulAdd(Intrinsic_t a, Intrinsic_t b, Intrinsic_t c){
+		union {
+			Intrinsic_t simdVec;
+			Element_t elements[dim];
+		} ua, ub, uc;
+		ua.simdVec = a;
+		ub.simdVec = b;
+		uc.simdVec = c;
+		for (int i = 0; i < dim; ++i) { ua.elements[i] = std::fma(ua.elements[i], ub.elements[i], uc.elements[i]); }
+		return ua.simdVec;
+	}
+
+	/* 積和（FMA 命令がある場合は融合積和を用いるため、丸め結果は環境に依存する）*/
+	static inline Intrinsic_t MulAdd(Intrinsic_t a, Intrinsic_t b, Intrinsic_t c){
+		return SimdVecTraits_t::Add(SimdVecTraits_t::Mul(a, b), c);
+	}
+};
+
 template<>
-struct GenSimdVecTraits<float, 4> {
+struct GenSimdVecTraits<float, 4> : GenSimdVecFunctions<GenSimdVecTraits<float, 4>, float, 4> {
 	typedef __m128 IntrinsicType_t;
 	enum {
-		isM128 = 1,
-		isM256 = 0,
+		isM128 = 1,
+		isM256 = 0,
+		isSimd = 1,
+	};
+
+	/* スカラのブロードキャスト */
+	static inline __m128 Set1(float x){ return _mm_set1_ps(x); }
+
+	/* 二項演算 */
+	static inline __m128 Add(__m128 a, __m128 b){ return _mm_add_ps(a, b); }
+	static inline __m128 Sub(__m128 a, __m128 b){ return _mm_sub_ps(a, b); }
+	static inline __m128 Mul(__m128 a, __m128 b){ return _mm_mul_ps(a, b); }
+	static inline __m128 Div(__m128 a, __m128 b){ return _mm_div_ps(a, b); }
+	static inline __m128 Min(__m128 a, __m128 b){ return _mm_min_ps(a, b); }
+	static inline __m128 Max(__m128 a, __m128 b){ return _mm_max_ps(a, b); }
+	static inline __m128 Sqrt(__m128 a){ return _mm_sqrt_ps(a); }
+
+#if !GLSLMATH_PRECISE_INVERTSQRT
+	/*
+		逆平方根
+		rsqrtps の近似値 y（相対誤差 1.5 * 2^-12 以下）をニュートン法で 1 回改良する。
+		y' = y * (1.5 - 0.5 * a * y * y) = (0.5 * y) * (3 - (a * y) * y)
+		y が 0 か inf の成分（a が inf 0 非正規化数）は改良せず y をそのまま返す。
+		その成分で 0 * inf（FE_INVALID）を計算しないよう、改良には [2^-70, 2^70] に制限した y を用いる
+		（正の正規化数の rsqrt は 2^-64 から 2^63 程度なので、制限されるのは 0 と inf だけ）。
+	*/
+	static inline __m128 InvertSqrt(__m128 a){
+		const __m128 y = _mm_rsqrt_ps(a);
+		const __m128 yc = _mm_min_ps(_mm_max_ps(y, _mm_set1_ps(/* 2^-70 */ 8.4703294725430034e-22f)), _mm_set1_ps(/* 2^70 */ 1180591620717411303424.0f));
+		const __m128 ayy = _mm_mul_ps(_mm_mul_ps(a, yc), yc);
+		return Select(
+			_mm_cmpeq_ps(y, yc),
+			_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), yc), _mm_sub_ps(_mm_set1_ps(3.0f), ayy)),
+			y
+		);
+	}
+#endif
+
+	/* ビット演算 */
+	static inline __m128 And   (__m128 a, __m128 b){ return _mm_and_ps(a, b); }
+	static inline __m128 AndNot(__m128 a, __m128 b){ return _mm_andnot_ps(a, b); }
+	static inline __m128 Or    (__m128 a, __m128 b){ return _mm_or_ps(a, b); }
+	static inline __m128 Xor   (__m128 a, __m128 b){ return _mm_xor_ps(a, b); }
+
+	/* 比較（結果は全ビット 1 または 0 のマスク）*/
+	static inline __m128 CmpLt(__m128 a, __m128 b){ return _mm_cmplt_ps(a, b); }
+	static inline __m128 CmpLe(__m128 a, __m128 b){ return _mm_cmple_ps(a, b); }
+	static inline __m128 CmpGt(__m128 a, __m128 b){ return _mm_cmpgt_ps(a, b); }
+	static inline __m128 CmpGe(__m128 a, __m128 b){ return _mm_cmpge_ps(a, b); }
+	static inline __m128 CmpEq(__m128 a, __m128 b){ return _mm_cmpeq_ps(a, b); }
+	static inline __m128 CmpNe(__m128 a, __m128 b){ return _mm_cmpneq_ps(a, b); }
+	static inline int MoveMask(__m128 a){ return _mm_movemask_ps(a); }
+
+	/* 成分ごとのビット列の論理シフト */
+	template<int n>
+	static inline __m128 ShiftLeftBits (__m128 a){ return _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(a), n)); }
+	template<int n>
+	static inline __m128 ShiftRightBits(__m128 a){ return _mm_castsi128_ps(_mm_srli_epi32(_mm_castps_si128(a), n)); }
+
+	/* SWIZZLE */
+	template<int swizzle>
+	static inline __m128 Swizzle(__m128 a){
+		enum {
+			imm = _MM_SHUFFLE((swizzle >> 12) & 3, (swizzle >> 8) & 3, (swizzle >> 4) & 3, swizzle & 3)
+		};
+#if GLSLMATH_USE_AVX
+		return _mm_permute_ps(a, imm);
+#else
+		return _mm_shuffle_ps(a, a, imm);
+#endif
+	}
+
+	/* 先頭 n 成分の読み込み（残りの成分は 0）*/
+	template<int n>
+	static inline __m128 LoadPartial(const float *p){
+		if constexpr (n == 1) {
+			return _mm_load_ss(p);
+		} else if constexpr (n == 2) {
+			return _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64 *>(p));
+		} else if constexpr (n == 3) {
+			return _mm_movelh_ps(_mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64 *>(p)), _mm_load_ss(p + 2));
+		} else {
+			return _mm_loadu_ps(p);
+		}
+	}
+
+	/* 先頭 n 成分の書き込み */
+	template<int n>
+	static inline void StorePartial(float *p, __m128 a){
+		if constexpr (n == 1) {
+			_mm_store_ss(p, a);
+		} else if constexpr (n == 2) {
+			_mm_storel_pi(reinterpret_cast<__m64 *>(p), a);
+		} else if constexpr (n == 3) {
+			_mm_storel_pi(reinterpret_cast<__m64 *>(p), a);
+			_mm_store_ss(p + 2, _mm_movehl_ps(a, a));
+		} else {
+			_mm_storeu_ps(p, a);
+		}
+	}
+
+	/* 4 本のレジスタを 4x4 行列とみなして転置 */
+	static inline void Transpose4(__m128 &r0, __m128 &r1, __m128 &r2, __m128 &r3){
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+	}
+
+	/* 2 入力の SWIZZLE */
+	template<int swizzle>
+	static inline __m128 Shuffle(__m128 a, __m128 b){
+		return _mm_shuffle_ps(a, b, _MM_SHUFFLE((swizzle >> 12) & 3, (swizzle >> 8) & 3, (swizzle >> 4) & 3, swizzle & 3));
+	}
+
+	/* 先頭成分の取り出し */
+	static inline float ExtractFirst(__m128 a){ return _mm_cvtss_f32(a); }
+
+	/* 定数マスクによる選択 */
+	template<int mask>
+	static inline __m128 Blend(__m128 a, __m128 b){
+		if constexpr ((mask & 15) == 0) {
+			return a;
+		} else if constexpr ((mask & 15) == 15) {
+			return b;
+		} else {
+#if GLSLMATH_USE_SSE4_1
+			return _mm_blend_ps(a, b, mask & 15);
+#else
+			const __m128 m = _mm_castsi128_ps(_mm_setr_epi32(-(mask & 1), -((mask >> 1) & 1), -((mask >> 2) & 1), -((mask >> 3) & 1)));
+			return _mm_or_ps(_mm_and_ps(m, b), _mm_andnot_ps(m, a));
+#endif
+		}
+	}
+
+#if GLSLMATH_USE_SSE4_1
+	/* 選択 */
+	static inline __m128 Select(__m128 mask, __m128 a, __m128 b){ return _mm_blendv_ps(b, a, mask); }
+
+	/* 丸め */
+	static inline __m128 Floor    (__m128 a){ return _mm_round_ps(a, _MM_FROUND_TO_NEG_INF     | _MM_FROUND_NO_EXC); }
+	static inline __m128 Ceil     (__m128 a){ return _mm_round_ps(a, _MM_FROUND_TO_POS_INF     | _MM_FROUND_NO_EXC); }
+	static inline __m128 Trunc    (__m128 a){ return _mm_round_ps(a, _MM_FROUND_TO_ZERO        | _MM_FROUND_NO_EXC); }
+	static inline __m128 RoundEven(__m128 a){ return _mm_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+	/* 先頭 n 成分の内積を全成分にブロードキャスト（dpps も (x + y) + (z + w) の順に加算する）*/
+	template<int n>
+	static inline __m128 DotBroadcast(__m128 a, __m128 b){ return _mm_dp_ps(a, b, (((1 << n) - 1) << 4) | 0xf); }
+#endif
+
+#if GLSLMATH_USE_FMA
+	/* 融合積和 */
+	static inline __m128 FusedMulAdd(__m128 a, __m128 b, __m128 c){ return _mm_fmadd_ps(a, b, c); }
+	static inline __m128 MulAdd     (__m128 a, __m128 b, __m128 c){ return _mm_fmadd_ps(a, b, c); }
+#endif
+};
+
+template<>
+struct GenSimdVecTraits<double, 2> : GenSimdVecFunctions<GenSimdVecTraits<double, 2>, double, 2> {
+	typedef __m128d IntrinsicType_t;
+	enum {
+		isM128 = 1,
+		isM256 = 0,
+		isSimd = 1,
+	};
+
+	/* スカラのブロードキャスト */
+	static inline __m128d Set1(double x){ return _mm_set1_pd(x); }
+
+	/* 二項演算 */
+	static inline __m128d Add(__m128d a, __m128d b){ return _mm_add_pd(a, b); }
+	static inline __m128d Sub(__m128d a, __m128d b){ return _mm_sub_pd(a, b); }
+	static inline __m128d Mul(__m128d a, __m128d b){ return _mm_mul_pd(a, b); }
+	static inline __m128d Div(__m128d a, __m128d b){ return _mm_div_pd(a, b); }
+	static inline __m128d Min(__m128d a, __m128d b){ return _mm_min_pd(a, b); }
+	static inline __m128d Max(__m128d a, __m128d b){ return _mm_max_pd(a, b); }
+	static inline __m128d Sqrt(__m128d a){ return _mm_sqrt_pd(a); }
+
+	/* ビット演算 */
+	static inline __m128d And   (__m128d a, __m128d b){ return _mm_and_pd(a, b); }
+	static inline __m128d AndNot(__m128d a, __m128d b){ return _mm_andnot_pd(a, b); }
+	static inline __m128d Or    (__m128d a, __m128d b){ return _mm_or_pd(a, b); }
+	static inline __m128d Xor   (__m128d a, __m128d b){ return _mm_xor_pd(a, b); }
+
+	/* 比較（結果は全ビット 1 または 0 のマスク）*/
+	static inline __m128d CmpLt(__m128d a, __m128d b){ return _mm_cmplt_pd(a, b); }
+	static inline __m128d CmpLe(__m128d a, __m128d b){ return _mm_cmple_pd(a, b); }
+	static inline __m128d CmpGt(__m128d a, __m128d b){ return _mm_cmpgt_pd(a, b); }
+	static inline __m128d CmpGe(__m128d a, __m128d b){ return _mm_cmpge_pd(a, b); }
+	static inline __m128d CmpEq(__m128d a, __m128d b){ return _mm_cmpeq_pd(a, b); }
+	static inline __m128d CmpNe(__m128d a, __m128d b){ return _mm_cmpneq_pd(a, b); }
+	static inline int MoveMask(__m128d a){ return _mm_movemask_pd(a); }
+
+	/* 成分ごとのビット列の論理シフト */
+	template<int n>
+	static inline __m128d ShiftLeftBits (__m128d a){ return _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(a), n)); }
+	template<int n>
+	static inline __m128d ShiftRightBits(__m128d a){ return _mm_castsi128_pd(_mm_srli_epi64(_mm_castpd_si128(a), n)); }
+
+	/* SWIZZLE */
+	template<int swizzle>
+	static inline __m128d Swizzle(__m128d a){
+		enum {
+			imm = (swizzle & 1) | (((swizzle >> 4) & 1) << 1)
+		};
+		return _mm_shuffle_pd(a, a, imm);
+	}
+
+	/* 先頭 n 成分の読み込み（残りの成分は 0）*/
+	template<int n>
+	static inline __m128d LoadPartial(const double *p){
+		if constexpr (n == 1) {
+			return _mm_load_sd(p);
+		} else {
+			return _mm_loadu_pd(p);
+		}
+	}
+
+	/* 定数マスクによる選択 */
+	template<int mask>
+	static inline __m128d Blend(__m128d a, __m128d b){
+		if constexpr ((mask & 3) == 0) {
+			return a;
+		} else if constexpr ((mask & 3) == 1) {
+			return _mm_move_sd(a, b);
+		} else if constexpr ((mask & 3) == 2) {
+			return _mm_shuffle_pd(a, b, 2);
+		} else {
+			return b;
+		}
+	}
+
+	/* 先頭 n 成分の内積を全成分にブロードキャスト */
+	template<int n>
+	static inline __m128d DotBroadcast(__m128d a, __m128d b){
+#if GLSLMATH_USE_SSE4_1
+		return _mm_dp_pd(a, b, (((1 << n) - 1) << 4) | 0x3);
+#else
+		if constexpr (n == 1) {
+			__m128d tmp = _mm_mul_sd(a, b);
+			return _mm_unpacklo_pd(tmp, tmp);
+		} else {
+			__m128d tmp = _mm_mul_pd(a, b);
+			return _mm_add_pd(tmp, _mm_shuffle_pd(tmp, tmp, 0x1));
+		}
+#endif
+	}
+
+#if GLSLMATH_USE_SSE4_1
+	/* 選択 */
+	static inline __m128d Select(__m128d mask, __m128d a, __m128d b){ return _mm_blendv_pd(b, a, mask); }
+
+	/* 丸め */
+	static inline __m128d Floor    (__m128d a){ return _mm_round_pd(a, _MM_FROUND_TO_NEG_INF     | _MM_FROUND_NO_EXC); }
+	static inline __m128d Ceil     (__m128d a){ return _mm_round_pd(a, _MM_FROUND_TO_POS_INF     | _MM_FROUND_NO_EXC); }
+	static inline __m128d Trunc    (__m128d a){ return _mm_round_pd(a, _MM_FROUND_TO_ZERO        | _MM_FROUND_NO_EXC); }
+	static inline __m128d RoundEven(__m128d a){ return _mm_round_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+#endif
+
+#if GLSLMATH_USE_FMA
+	/* 融合積和 */
+	static inline __m128d FusedMulAdd(__m128d a, __m128d b, __m128d c){ return _mm_fmadd_pd(a, b, c); }
+	static inline __m128d MulAdd     (__m128d a, __m128d b, __m128d c){ return _mm_fmadd_pd(a, b, c); }
+#endif
+};
+
+template<>
+struct GenSimdVecTraits<double, 4> : GenSimdVecFunctions<GenSimdVecTraits<double, 4>, double, 4> {
+	typedef __m256d IntrinsicType_t;
+	enum {
+		isM128 = 0,
+		isM256 = 1,
+		isSimd = GLSLMATH_USE_AVX,
+	};
+
+#if GLSLMATH_USE_AVX
+	/* スカラのブロードキャスト */
+	static inline __m256d Set1(double x){ return _mm256_set1_pd(x); }
+
+	/* 二項演算 */
+	static inline __m256d Add(__m256d a, __m256d b){ return _mm256_add_pd(a, b); }
+	static inline __m256d Sub(__m256d a, __m256d b){ return _mm256_sub_pd(a, b); }
+	static inline __m256d Mul(__m256d a, __m256d b){ return _mm256_mul_pd(a, b); }
+	static inline __m256d Div(__m256d a, __m256d b){ return _mm256_div_pd(a, b); }
+	static inline __m256d Min(__m256d a, __m256d b){ return _mm256_min_pd(a, b); }
+	static inline __m256d Max(__m256d a, __m256d b){ return _mm256_max_pd(a, b); }
+	static inline __m256d Sqrt(__m256d a){ return _mm256_sqrt_pd(a); }
+
+	/* ビット演算 */
+	static inline __m256d And   (__m256d a, __m256d b){ return _mm256_and_pd(a, b); }
+	static inline __m256d AndNot(__m256d a, __m256d b){ return _mm256_andnot_pd(a, b); }
+	static inline __m256d Or    (__m256d a, __m256d b){ return _mm256_or_pd(a, b); }
+	static inline __m256d Xor   (__m256d a, __m256d b){ return _mm256_xor_pd(a, b); }
+
+	/* 比較（結果は全ビット 1 または 0 のマスク）*/
+	static inline __m256d CmpLt(__m256d a, __m256d b){ return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+	static inline __m256d CmpLe(__m256d a, __m256d b){ return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+	static inline __m256d CmpGt(__m256d a, __m256d b){ return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+	static inline __m256d CmpGe(__m256d a, __m256d b){ return _mm256_cmp_pd(a, b, _CMP_GE_OQ); }
+	static inline __m256d CmpEq(__m256d a, __m256d b){ return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+	static inline __m256d CmpNe(__m256d a, __m256d b){ return _mm256_cmp_pd(a, b, _CMP_NEQ_UQ); }
+	static inline int MoveMask(__m256d a){ return _mm256_movemask_pd(a); }
+
+	/* 成分ごとのビット列の論理シフト（AVX2 が無い場合は 128 ビットずつ処理する）*/
+	template<int n>
+	static inline __m256d ShiftLeftBits(__m256d a){
+#if GLSLMATH_USE_AVX2
+		return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(a), n));
+#else
+		const __m128i lo = _mm_slli_epi64(_mm_castpd_si128(_mm256_castpd256_pd128(a)), n);
+		const __m128i hi = _mm_slli_epi64(_mm_castpd_si128(_mm256_extractf128_pd(a, 1)), n);
+		return _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_castsi128_pd(lo)), _mm_castsi128_pd(hi), 1);
+#endif
+	}
+	template<int n>
+	static inline __m256d ShiftRightBits(__m256d a){
+#if GLSLMATH_USE_AVX2
+		return _mm256_castsi256_pd(_mm256_srli_epi64(_mm256_castpd_si256(a), n));
+#else
+		const __m128i lo = _mm_srli_epi64(_mm_castpd_si128(_mm256_castpd256_pd128(a)), n);
+		const __m128i hi = _mm_srli_epi64(_mm_castpd_si128(_mm256_extractf128_pd(a, 1)), n);
+		return _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_castsi128_pd(lo)), _mm_castsi128_pd(hi), 1);
+#endif
+	}
+
+	/* SWIZZLE */
+	template<int swizzle>
+	static inline __m256d Swizzle(__m256d a){
+		enum {
+			i0 =  swizzle        & 3,
+			i1 = (swizzle >>  4) & 3,
+			i2 = (swizzle >>  8) & 3,
+			i3 = (swizzle >> 12) & 3,
+		};
+#if GLSLMATH_USE_AVX2
+		return _mm256_permute4x64_pd(a, _MM_SHUFFLE(i3, i2, i1, i0));
+#else
+		/*
+			AVX には 128 bit 境界を跨ぐ任意の並べ替え命令が無い。
+			下位 128 bit と上位 128 bit をそれぞれ両側に複製したもの、または上下を入れ替えたものから
+			128 bit 内の並べ替えで成分を選び、ブレンドで合成する。
+		*/
+		enum {
+			permuteImm = (i0 & 1) | ((i1 & 1) << 1) | ((i2 & 1) << 2) | ((i3 & 1) << 3),
+			blendImm   = (i0 >> 1) | ((i1 >> 1) << 1) | ((i2 >> 1) << 2) | ((i3 >> 1) << 3),
+
+			/* 自身と反対側の 128 bit から成分を取る位置 */
+			crossImm   = blendImm ^ 0xc,
+		};
+		if constexpr (blendImm == 0x0) {
+			return _mm256_permute_pd(_mm256_permute2f128_pd(a, a, 0x00), permuteImm);
+		} else if constexpr (blendImm == 0xf) {
+			return _mm256_permute_pd(_mm256_permute2f128_pd(a, a, 0x11), permuteImm);
+		} else if constexpr (blendImm == 0xc) {
+			return _mm256_permute_pd(a, permuteImm);
+		} else if constexpr (blendImm == 0x3) {
+			return _mm256_permute_pd(_mm256_permute2f128_pd(a, a, 0x01), permuteImm);
+		} else {
+			__m256d same  = _mm256_permute_pd(a, permuteImm);
+			__m256d cross = _mm256_permute_pd(_mm256_permute2f128_pd(a, a, 0x01), permuteImm);
+			return _mm256_blend_pd(same, cross, crossImm);
+		}
+#endif
+	}
+
+	/* 先頭 n 成分の読み込み（残りの成分は 0）*/
+	template<int n>
+	static inline __m256d LoadPartial(const double *p){
+		if constexpr (n >= 4) {
+			return _mm256_loadu_pd(p);
+		} else {
+			return _mm256_maskload_pd(p, _mm256_setr_epi64x(-1, (n >= 2)? -1 : 0, (n >= 3)? -1 : 0, 0));
+		}
+	}
+
+	/* 先頭 n 成分の書き込み */
+	template<int n>
+	static inline void StorePartial(double *p, __m256d a){
+		if constexpr (n >= 4) {
+			_mm256_storeu_pd(p, a);
+		} else if constexpr (n == 2) {
+			_mm_storeu_pd(p, _mm256_castpd256_pd128(a));
+		} else {
+			_mm256_maskstore_pd(p, _mm256_setr_epi64x(-1, (n >= 2)? -1 : 0, (n >= 3)? -1 : 0, 0), a);
+		}
+	}
+
+	/*
+		4 本のレジスタを 4x4 行列とみなして転置
+		128 bit 内で 2x2 ブロックを転置した後、128 bit 単位でブロックを入れ替える。
+	*/
+	static inline void Transpose4(__m256d &r0, __m256d &r1, __m256d &r2, __m256d &r3){
+		__m256d t0 = _mm256_unpacklo_pd(r0, r1);
+		__m256d t1 = _mm256_unpackhi_pd(r0, r1);
+		__m256d t2 = _mm256_unpacklo_pd(r2, r3);
+		__m256d t3 = _mm256_unpackhi_pd(r2, r3);
+		r0 = _mm256_permute2f128_pd(t0, t2, 0x20);
+		r1 = _mm256_permute2f128_pd(t1, t3, 0x20);
+		r2 = _mm256_permute2f128_pd(t0, t2, 0x31);
+		r3 = _mm256_permute2f128_pd(t1, t3, 0x31);
+	}
+
+	/* 定数マスクによる選択 */
+	template<int mask>
+	static inline __m256d Blend(__m256d a, __m256d b){
+		if constexpr ((mask & 15) == 0) {
+			return a;
+		} else if constexpr ((mask & 15) == 15) {
+			return b;
+		} else {
+			return _mm256_blend_pd(a, b, mask & 15);
+		}
+	}
+
+	/* 選択 */
+	static inline __m256d Select(__m256d mask, __m256d a, __m256d b){ return _mm256_blendv_pd(b, a, mask); }
+
+	/* 丸め */
+	static inline __m256d Floor    (__m256d a){ return _mm256_round_pd(a, _MM_FROUND_TO_NEG_INF     | _MM_FROUND_NO_EXC); }
+	static inline __m256d Ceil     (__m256d a){ return _mm256_round_pd(a, _MM_FROUND_TO_POS_INF     | _MM_FROUND_NO_EXC); }
+	static inline __m256d Trunc    (__m256d a){ return _mm256_round_pd(a, _MM_FROUND_TO_ZERO        | _MM_FROUND_NO_EXC); }
+	static inline __m256d RoundEven(__m256d a){ return _mm256_round_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+	/*
+		先頭 n 成分の内積を全成分にブロードキャスト
+		128 bit 内の水平加算の後、上下の 128 bit を入れ替えて加算する（(x + y) + (z + w) の順）。
+	*/
+	template<int n>
+	static inline __m256d DotBroadcast(__m256d a, __m256d b){
+		__m256d tmp = Blend<0xf & ~((1 << n) - 1)>(_mm256_mul_pd(a, b), _mm256_setzero_pd());
+		tmp = _mm256_hadd_pd(tmp, tmp);
+		return _mm256_add_pd(tmp, _mm256_permute2f128_pd(tmp, tmp, 0x01));
+	}
+#endif
+
+#if GLSLMATH_USE_AVX && GLSLMATH_USE_FMA
+	/* 融合積和 */
+	static inline __m256d FusedMulAdd(__m256d a, __m256d b, __m256d c){ return _mm256_fmadd_pd(a, b, c); }
+	static inline __m256d MulAdd     (__m256d a, __m256d b, __m256d c){ return _mm256_fmadd_pd(a, b, c); }
+#endif
+};
+
+/*
+	32 bit 整数 4 成分の SIMD 型共通の関数群
+	符号の有無で結果が異なる演算（比較 右シフト 最小 最大 abs sign）は SimdVecTraits_t 側で定義する。
+*/
+template<typename SimdVecTraits_t, typename Element_t>
+struct GenSimdIvec4Functions : GenSimdVecFunctions<SimdVecTraits_t, Element_t, 4> {
+	typedef __m128i IntrinsicType_t;
+	enum {
+		isM128 = 1,
+		isM256 = 0,
+		isSimd = 1,
+	};
+
+	/* スカラのブロードキャスト */
+	static inline __m128i Set1(Element_t x){ return _mm_set1_epi32(static_cast<int>(x)); }
+
+	/* 単項演算 */
+	static inline __m128i Neg(__m128i a){ return _mm_sub_epi32(_mm_setzero_si128(), a); }
+	static inline __m128i Not(__m128i a){ return _mm_xor_si128(a, _mm_set1_epi32(-1)); }
+
+	/* 二項演算 */
+	static inline __m128i Add(__m128i a, __m128i b){ return _mm_add_epi32(a, b); }
+	static inline __m128i Sub(__m128i a, __m128i b){ return _mm_sub_epi32(a, b); }
+	static inline __m128i Mul(__m128i a, __m128i b){
+#if GLSLMATH_USE_SSE4_1
+		return _mm_mullo_epi32(a, b);
+#else
+		/* 偶数成分と奇数成分を 32x32->64 bit 乗算し、下位 32 bit を集める */
+		__m128i even = _mm_mul_epu32(a, b);
+		__m128i odd  = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+		return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+#endif
+	}
+
+	/* 整数除算命令は無いので成分ごとに除算する */
+	static inline __m128i Div(__m128i a, __m128i b){
+		union {
+			__m128i simdVec;
+			Element_t elements[4];
+		} ua, ub;
+		ua.simdVec = a;
+		ub.simdVec = b;
+		for (int i = 0; i < 4; ++i) { ua.elements[i] /= ub.elements[i]; }
+		return ua.simdVec;
+	}
+
+	/* ビット演算 */
+	static inline __m128i And   (__m128i a, __m128i b){ return _mm_and_si128(a, b); }
+	static inline __m128i AndNot(__m128i a, __m128i b){ return _mm_andnot_si128(a, b); }
+	static inline __m128i Or    (__m128i a, __m128i b){ return _mm_or_si128(a, b); }
+	static inline __m128i Xor   (__m128i a, __m128i b){ return _mm_xor_si128(a, b); }
+
+	/* シフト（成分ごとのシフト量）*/
+	static inline __m128i ShiftLeft(__m128i a, __m128i b){
+#if GLSLMATH_USE_AVX2
+		return _mm_sllv_epi32(a, b);
+#else
+		union {
+			__m128i simdVec;
+			Element_t elements[4];
+		} ua, ub;
+		ua.simdVec = a;
+		ub.simdVec = b;
+		for (int i = 0; i < 4; ++i) { ua.elements[i] <<= ub.elements[i]; }
+		return ua.simdVec;
+#endif
+	}
+
+	/* シフト（全成分共通のシフト量）*/
+	static inline __m128i ShiftLeftScalar(__m128i a, int count){ return _mm_sll_epi32(a, _mm_cvtsi32_si128(count)); }
+
+	/* 比較（結果は全ビット 1 または 0 のマスク）*/
+	static inline __m128i CmpEq(__m128i a, __m128i b){ return _mm_cmpeq_epi32(a, b); }
+	static inline __m128i CmpNe(__m128i a, __m128i b){ return Not(_mm_cmpeq_epi32(a, b)); }
+	static inline __m128i CmpLe(__m128i a, __m128i b){ return Not(SimdVecTraits_t::CmpGt(a, b)); }
+	static inline __m128i CmpGe(__m128i a, __m128i b){ return Not(SimdVecTraits_t::CmpLt(a, b)); }
+	static inline int MoveMask(__m128i a){ return _mm_movemask_ps(_mm_castsi128_ps(a)); }
+
+	/* 最小 最大 */
+	static inline __m128i Min(__m128i a, __m128i b){ return SimdVecTraits_t::Select(SimdVecTraits_t::CmpLt(a, b), a, b); }
+	static inline __m128i Max(__m128i a, __m128i b){ return SimdVecTraits_t::Select(SimdVecTraits_t::CmpGt(a, b), a, b); }
+
+	/* SWIZZLE */
+	template<int swizzle>
+	static inline __m128i Swizzle(__m128i a){
+		return _mm_shuffle_epi32(a, _MM_SHUFFLE((swizzle >> 12) & 3, (swizzle >> 8) & 3, (swizzle >> 4) & 3, swizzle & 3));
+	}
+
+	/* 先頭 n 成分の読み込み（残りの成分は 0）*/
+	template<int n>
+	static inline __m128i LoadPartial(const Element_t *p){
+		if constexpr (n == 1) {
+			return _mm_cvtsi32_si128(static_cast<int>(p[0]));
+		} else if constexpr (n == 2) {
+			return _mm_loadl_epi64(reinterpret_cast<const __m128i *>(p));
+		} else if constexpr (n == 3) {
+			return _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(p)), _mm_cvtsi32_si128(static_cast<int>(p[2])));
+		} else {
+			return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+		}
+	}
+
+	/* 定数マスクによる選択 */
+	template<int mask>
+	static inline __m128i Blend(__m128i a, __m128i b){
+		if constexpr ((mask & 15) == 0) {
+			return a;
+		} else if constexpr ((mask & 15) == 15) {
+			return b;
+		} else {
+#if GLSLMATH_USE_SSE4_1
+			/* 16 bit 単位のブレンドなので、成分ごとに 2 bit ずつ立てる */
+			return _mm_blend_epi16(a, b, ((mask & 1) * 0x03) | (((mask >> 1) & 1) * 0x0c) | (((mask >> 2) & 1) * 0x30) | (((mask >> 3) & 1) * 0xc0));
+#else
+			const __m128i m = _mm_setr_epi32(-(mask & 1), -((mask >> 1) & 1), -((mask >> 2) & 1), -((mask >> 3) & 1));
+			return _mm_or_si128(_mm_and_si128(m, b), _mm_andnot_si128(m, a));
+#endif
+		}
+	}
+
+#if GLSLMATH_USE_SSE4_1
+	/* 選択 */
+	static inline __m128i Select(__m128i mask, __m128i a, __m128i b){ return _mm_blendv_epi8(b, a, mask); }
+#endif
+};
+
+template<>
+struct GenSimdVecTraits<int, 4> : GenSimdIvec4Functions<GenSimdVecTraits<int, 4>, int> {
+	/* 比較（結果は全ビット 1 または 0 のマスク）*/
+	static inline __m128i CmpLt(__m128i a, __m128i b){ return _mm_cmplt_epi32(a, b); }
+	static inline __m128i CmpGt(__m128i a, __m128i b){ return _mm_cmpgt_epi32(a, b); }
+
+	/* 算術右シフト */
+	static inline __m128i ShiftRight(__m128i a, __m128i b){
+#if GLSLMATH_USE_AVX2
+		return _mm_srav_epi32(a, b);
+#else
+		union {
+			__m128i simdVec;
+			int elements[4];
+		} ua, ub;
+		ua.simdVec = a;
+		ub.simdVec = b;
+		for (int i = 0; i < 4; ++i) { ua.elements[i] >>= ub.elements[i]; }
+		return ua.simdVec;
+#endif
+	}
+	static inline __m128i ShiftRightScalar(__m128i a, int count){ return _mm_sra_epi32(a, _mm_cvtsi32_si128(count)); }
+
+	/* 要素ごとの関数 */
+	static inline __m128i Abs(__m128i a){
+#if GLSLMATH_USE_SSE4_1
+		return _mm_abs_epi32(a);
+#else
+		__m128i sign = _mm_srai_epi32(a, 31);
+		return _mm_sub_epi32(_mm_xor_si128(a, sign), sign);
+#endif
+	}
+	static inline __m128i Sign(__m128i a){
+		/* 正なら 0 - (-1)、負なら (-1) - 0 */
+		__m128i zero = _mm_setzero_si128();
+		return _mm_sub_epi32(_mm_cmpgt_epi32(zero, a), _mm_cmpgt_epi32(a, zero));
+	}
+
+#if GLSLMATH_USE_SSE4_1
+	/* 最小 最大 */
+	static inline __m128i Min(__m128i a, __m128i b){ return _mm_min_epi32(a, b); }
+	static inline __m128i Max(__m128i a, __m128i b){ return _mm_max_epi32(a, b); }
+#endif
+};
+
+template<>
+struct GenSimdVecTraits<unsigned int, 4> : GenSimdIvec4Functions<GenSimdVecTraits<unsigned int, 4>, unsigned int> {
+	/* 比較（符号ビットを反転して符号付き比較を行う）*/
+	static inline __m128i CmpLt(__m128i a, __m128i b){
+		const __m128i bias = _mm_set1_epi32(int(0x80000000u));
+		return _mm_cmplt_epi32(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+	}
+	static inline __m128i CmpGt(__m128i a, __m128i b){
+		const __m128i bias = _mm_set1_epi32(int(0x80000000u));
+		return _mm_cmpgt_epi32(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+	}
+
+	/* 論理右シフト */
+	static inline __m128i ShiftRight(__m128i a, __m128i b){
+#if GLSLMATH_USE_AVX2
+		return _mm_srlv_epi32(a, b);
+#else
+		union {
+			__m128i simdVec;
+			unsigned int elements[4];
+		} ua, ub;
+		ua.simdVec = a;
+		ub.simdVec = b;
+		for (int i = 0; i < 4; ++i) { ua.elements[i] >>= ub.elements[i]; }
+		return ua.simdVec;
+#endif
+	}
+	static inline __m128i ShiftRightScalar(__m128i a, int count){ return _mm_srl_epi32(a, _mm_cvtsi32_si128(count)); }
+
+	/* 要素ごとの関数 */
+	static inline __m128i Abs(__m128i a){ return a; }
+	static inline __m128i Sign(__m128i a){ return _mm_and_si128(Not(_mm_cmpeq_epi32(a, _mm_setzero_si128())), _mm_set1_epi32(1)); }
+
+#if GLSLMATH_USE_SSE4_1
+	/* 最小 最大 */
+	static inline __m128i Min(__m128i a, __m128i b){ return _mm_min_epu32(a, b); }
+	static inline __m128i Max(__m128i a, __m128i b){ return _mm_max_epu32(a, b); }
+#endif
+};
+
+
+/*
+	レーンマスク形式の Bvec
+	float 4 成分と同じ __m128 に保持し、SWIZZLE や Blend などのレーン操作は float 4 成分の実装を流用する。
+*/
+template<>
+struct GenSimdVecTraits<LaneBool, 4> : GenSimdVecTraits<float, 4> {
+	/* スカラのブロードキャスト */
+	static inline __m128 Set1(bool x){ return _mm_castsi128_ps(_mm_set1_epi32(x? -1 : 0)); }
+
+	/* 比較結果のマスクから変換 */
+	static inline __m128 FromMask(__m128 a){ return a; }
+	static inline __m128 FromMask(__m128i a){ return _mm_castsi128_ps(a); }
+
+	/* 論理演算 */
+	static inline __m128 LogicalNot(__m128 a){ return _mm_xor_ps(a, _mm_castsi128_ps(_mm_set1_epi32(-1))); }
+	static inline __m128 LogicalAnd(__m128 a, __m128 b){ return _mm_and_ps(a, b); }
+	static inline __m128 LogicalOr (__m128 a, __m128 b){ return _mm_or_ps(a, b); }
+
+	/* 比較（false < true として扱う）*/
+	static inline __m128 CmpLt(__m128 a, __m128 b){ return _mm_andnot_ps(a, b); }
+	static inline __m128 CmpGt(__m128 a, __m128 b){ return _mm_andnot_ps(b, a); }
+
+	/* 先頭 n 成分の読み込み（残りの成分は 0）*/
+	template<int n>
+	static inline __m128 LoadPartial(const LaneBool *p){
+		return _mm_castsi128_ps(GenSimdVecTraits<int, 4>::template LoadPartial<n>(reinterpret_cast<const int *>(p)));
+	}
+};
+
+
+/*
+	行列全体を 1 本のレジスタに保持する SIMD 型
+	isSimd が 0 の型の IntrinsicType_t は、列成分と同じ大きさの配列とする（参照されない）。
+*/
+template<typename Element_t, int memDimC, int memDimR>
+struct GenSimdMatTraits {
+	typedef Element_t IntrinsicType_t[memDimC * memDimR];
+	using SimdVecTraits_t = GenSimdVecTraits<Element_t, memDimC * memDimR>;
+	enum {
+		isSimd = 0,
 	};
 };
 
+/* float 2x2 行列は 4 成分なので __m128 に収まる */
 template<>
-struct GenSimdVecTraits<double, 4> {
-	typedef __m256 IntrinsicType_t;
+struct GenSimdMatTraits<float, 2, 2> {
+	typedef __m128 IntrinsicType_t;
+	using SimdVecTraits_t = GenSimdVecTraits<float, 4>;
 	enum {
-		isM128 = 0,
-		isM256 = 1,
+		isSimd = 1,
 	};
 };
 
@@ -204,10 +2201,16 @@ struct GenSimdVecTraits<double, 4> {
 		using This_t = Type_t<Element0_t, Traits0_t, recursiveCount0>;\
 \
 		/* 中間値の型（SWIZZLE 解決済み）*/\
-		using Temp_t = Gen##Type_t<Element0_t, Traits0_t::opeDim>;\
+		using Temp_t = Gen##Type_t##2<Element0_t, Traits0_t::opeDim, Traits0_t::tempMemDim>;\
 \
 		/* SIMD 型 */\
 		using SimdVecTraits_t = GenSimdVecTraits<Element0_t, Traits0_t::memDim>;\
+\
+		/* SIMD 演算の可否（SWIZZLE を伴わず、全成分が演算対象である場合のみ可）*/\
+		enum { isSimdPath = SimdPath<Element0_t, Traits0_t>::isEnabled };\
+\
+		/* SWIZZLE を SIMD レジスタ上で解決した読み出しの可否 */\
+		enum { isSimdReadPath = SimdPath<Element0_t, Traits0_t>::isReadable };\
 \
 	public:\
 		/* ベクトル成分 */\
@@ -219,6 +2222,25 @@ struct GenSimdVecTraits<double, 4> {
 		/* this ポインタを取得 */\
 		inline       This_t * GetThisPointer()       { return this; }\
 		inline const This_t * GetThisPointer() const { return this; }\
+\
+		/*\
+			SWIZZLE 解決済みの SIMD 型を取得（isSimdReadPath の場合のみ利用可）\
+			内積のように演算次元を超える成分を捨てる演算では、SIMD 型のメモリ次元数であれば常に利用できる。\
+		*/\
+		inline auto GetSimdVec() const {\
+			if constexpr (Traits0_t::isIdentitySwizzle) {\
+				return this->simdVec;\
+			} else {\
+				return SimdVecTraits_t::template Swizzle<Traits0_t::swizzle>(this->simdVec);\
+			}\
+		}\
+\
+		/* パディング成分を 0 で埋める（パディング付きの型以外では何もしない）*/\
+		inline void ClearPadding(){\
+			if constexpr (Traits0_t::isPadded) {\
+				for (int i = Traits0_t::opeDim; i < Traits0_t::memDim; ++i) { this->elements[i] = 0; }\
+			}\
+		}\
 
 /* [] アクセス */
 #define IMPL_VEC_ARRAY_SUBSCRIPT_OPERATOR()\
@@ -241,10 +2263,14 @@ struct GenSimdVecTraits<double, 4> {
 	}\
 
 /* 単項演算 */
-#define IMPL_VEC_UNARY_OPERATOR(OP)\
+#define IMPL_VEC_UNARY_OPERATOR(OP, simdFunc)\
 	inline Temp_t operator OP() const {\
 		Temp_t result;\
 		static_assert(Traits0_t::isValid);\
+		if constexpr (isSimdReadPath) {\
+			result.simdVec = SimdVecTraits_t::simdFunc(this->GetSimdVec());\
+			return result;\
+		}\
 		if constexpr (Traits0_t::opeDim >= 1) { result.elements[0] = OP this->elements[Traits0_t::i0]; }\
 		if constexpr (Traits0_t::opeDim >= 2) { result.elements[1] = OP this->elements[Traits0_t::i1]; }\
 		if constexpr (Traits0_t::opeDim >= 3) { result.elements[2] = OP this->elements[Traits0_t::i2]; }\
@@ -253,12 +2279,16 @@ struct GenSimdVecTraits<double, 4> {
 	}\
 
 /* 二項演算 */
-#define IMPL_VEC_BINARY_OPERATOR(OP)\
+#define IMPL_VEC_BINARY_OPERATOR(OP, simdFunc)\
 	inline Temp_t operator OP(\
 		const Temp_t &rParam\
 	) const {\
 		Temp_t result;\
 		static_assert(Traits0_t::isValid);\
+		if constexpr (isSimdReadPath) {\
+			result.simdVec = SimdVecTraits_t::simdFunc(this->GetSimdVec(), SimdPath<Element0_t, Traits0_t>::template PadOperand<PaddingOperand_##simdFunc>(rParam.simdVec));\
+			return result;\
+		}\
 		if constexpr (Traits0_t::opeDim >= 1) { result.elements[0] = this->elements[Traits0_t::i0] OP rParam.elements[0]; }\
 		if constexpr (Traits0_t::opeDim >= 2) { result.elements[1] = this->elements[Traits0_t::i1] OP rParam.elements[1]; }\
 		if constexpr (Traits0_t::opeDim >= 3) { result.elements[2] = this->elements[Traits0_t::i2] OP rParam.elements[2]; }\
@@ -267,12 +2297,16 @@ struct GenSimdVecTraits<double, 4> {
 	}\
 
 /* 二項演算（スカラ）*/
-#define IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(OP)\
+#define IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(OP, simdFunc)\
 	inline Temp_t operator OP(\
 		const Element0_t param\
 	) const {\
 		Temp_t result;\
 		static_assert(Traits0_t::isValid);\
+		if constexpr (isSimdReadPath) {\
+			result.simdVec = SimdVecTraits_t::simdFunc(this->GetSimdVec(), SimdPath<Element0_t, Traits0_t>::template Set1Operand<PaddingOperand_##simdFunc>(param));\
+			return result;\
+		}\
 		if constexpr (Traits0_t::opeDim >= 1) { result.elements[0] = this->elements[Traits0_t::i0] OP param; }\
 		if constexpr (Traits0_t::opeDim >= 2) { result.elements[1] = this->elements[Traits0_t::i1] OP param; }\
 		if constexpr (Traits0_t::opeDim >= 3) { result.elements[2] = this->elements[Traits0_t::i2] OP param; }\
@@ -281,11 +2315,34 @@ struct GenSimdVecTraits<double, 4> {
 	}\
 
 /* 二項演算と代入 */
-#define IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(OP)\
+#define IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(OP, simdFunc)\
 	inline This_t& operator OP##=(\
 		const Temp_t &rParam\
 	){\
 		static_assert(Traits0_t::isValid);\
+		if constexpr (isSimdPath) {\
+			this->simdVec = SimdVecTraits_t::simdFunc(this->simdVec, SimdPath<Element0_t, Traits0_t>::template PadOperand<PaddingOperand_##simdFunc>(rParam.simdVec));\
+			return *this;\
+		} else if constexpr (SimdVecTraits_t::isSimd) {\
+			/*\
+				右辺をメモリ上の成分位置へ並べ替えて演算し、書き込み対象の成分のみ差し替える\
+				書き込み対象外の成分の右辺は 1 にする（0 除算などの浮動小数点例外を起こさないため）\
+			*/\
+			typename SimdVecTraits_t::IntrinsicType_t simdVec1;\
+			if constexpr (Traits0_t::opeDim == Traits0_t::memDim) {\
+				simdVec1 = rParam.simdVec;\
+			} else {\
+				simdVec1 = SimdVecTraits_t::template LoadPartial<Traits0_t::opeDim>(rParam.elements);\
+			}\
+			if constexpr (!Traits0_t::isIdentitySwizzle) {\
+				simdVec1 = SimdVecTraits_t::template Swizzle<Traits0_t::inverseSwizzle>(simdVec1);\
+			}\
+			simdVec1 = SimdVecTraits_t::template Blend<Traits0_t::writeMask>(SimdVecTraits_t::Set1(Element0_t(1)), simdVec1);\
+			this->simdVec = SimdVecTraits_t::template Blend<Traits0_t::writeMask>(\
+				this->simdVec, SimdVecTraits_t::simdFunc(this->simdVec, simdVec1)\
+			);\
+			return *this;\
+		}\
 		if constexpr (Traits0_t::opeDim >= 1) { this->elements[Traits0_t::i0] OP##= rParam.elements[0]; }\
 		if constexpr (Traits0_t::opeDim >= 2) { this->elements[Traits0_t::i1] OP##= rParam.elements[1]; }\
 		if constexpr (Traits0_t::opeDim >= 3) { this->elements[Traits0_t::i2] OP##= rParam.elements[2]; }\
@@ -294,11 +2351,24 @@ struct GenSimdVecTraits<double, 4> {
 	}\
 
 /* 二項演算と代入（スカラ）*/
-#define IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(OP)\
+#define IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(OP, simdFunc)\
 	inline This_t& operator OP##=(\
 		const Element0_t param\
 	){\
 		static_assert(Traits0_t::isValid);\
+		if constexpr (isSimdPath) {\
+			this->simdVec = SimdVecTraits_t::simdFunc(this->simdVec, SimdPath<Element0_t, Traits0_t>::template Set1Operand<PaddingOperand_##simdFunc>(param));\
+			return *this;\
+		} else if constexpr (SimdVecTraits_t::isSimd) {\
+			/* 書き込み対象の成分のみ差し替える（書き込み対象外の成分の右辺は 1 にする）*/\
+			const typename SimdVecTraits_t::IntrinsicType_t simdParam = SimdVecTraits_t::template Blend<Traits0_t::writeMask>(\
+				SimdVecTraits_t::Set1(Element0_t(1)), SimdVecTraits_t::Set1(param)\
+			);\
+			this->simdVec = SimdVecTraits_t::template Blend<Traits0_t::writeMask>(\
+				this->simdVec, SimdVecTraits_t::simdFunc(this->simdVec, simdParam)\
+			);\
+			return *this;\
+		}\
 		if constexpr (Traits0_t::opeDim >= 1) { this->elements[Traits0_t::i0] OP##= param; }\
 		if constexpr (Traits0_t::opeDim >= 2) { this->elements[Traits0_t::i1] OP##= param; }\
 		if constexpr (Traits0_t::opeDim >= 3) { this->elements[Traits0_t::i2] OP##= param; }\
@@ -314,6 +2384,10 @@ struct GenSimdVecTraits<double, 4> {
 		Temp_t result;\
 		static_assert(Traits0_t::isValid);\
 		Element0_t invParam = 1 / param;\
+		if constexpr (isSimdReadPath) {\
+			result.simdVec = SimdVecTraits_t::Mul(this->GetSimdVec(), SimdPath<Element0_t, Traits0_t>::template Set1Operand<PaddingOperand_Mul>(invParam));\
+			return result;\
+		}\
 		if constexpr (Traits0_t::opeDim >= 1) { result.elements[0] = this->elements[Traits0_t::i0] * invParam; }\
 		if constexpr (Traits0_t::opeDim >= 2) { result.elements[1] = this->elements[Traits0_t::i1] * invParam; }\
 		if constexpr (Traits0_t::opeDim >= 3) { result.elements[2] = this->elements[Traits0_t::i2] * invParam; }\
@@ -328,6 +2402,19 @@ struct GenSimdVecTraits<double, 4> {
 	){\
 		static_assert(Traits0_t::isValid);\
 		Element0_t invParam = 1 / param;\
+		if constexpr (isSimdPath) {\
+			this->simdVec = SimdVecTraits_t::Mul(this->simdVec, SimdPath<Element0_t, Traits0_t>::template Set1Operand<PaddingOperand_Mul>(invParam));\
+			return *this;\
+		} else if constexpr (SimdVecTraits_t::isSimd) {\
+			/* 書き込み対象の成分のみ差し替える（書き込み対象外の成分の右辺は 1 にする）*/\
+			const typename SimdVecTraits_t::IntrinsicType_t simdInvParam = SimdVecTraits_t::template Blend<Traits0_t::writeMask>(\
+				SimdVecTraits_t::Set1(Element0_t(1)), SimdVecTraits_t::Set1(invParam)\
+			);\
+			this->simdVec = SimdVecTraits_t::template Blend<Traits0_t::writeMask>(\
+				this->simdVec, SimdVecTraits_t::Mul(this->simdVec, simdInvParam)\
+			);\
+			return *this;\
+		}\
 		if constexpr (Traits0_t::opeDim >= 1) { this->elements[Traits0_t::i0] *= invParam; }\
 		if constexpr (Traits0_t::opeDim >= 2) { this->elements[Traits0_t::i1] *= invParam; }\
 		if constexpr (Traits0_t::opeDim >= 3) { this->elements[Traits0_t::i2] *= invParam; }\
@@ -335,6 +2422,47 @@ struct GenSimdVecTraits<double, 4> {
 		return *this;\
 	}\
 
+/* シフト（全成分共通のシフト量）*/
+#define IMPL_VEC_SHIFT_OPERATOR_WITH_SCALAR(OP, simdFunc)\
+	inline Temp_t operator OP(\
+		const Element0_t param\
+	) const {\
+		Temp_t result;\
+		static_assert(Traits0_t::isValid);\
+		if constexpr (isSimdReadPath) {\
+			result.simdVec = SimdVecTraits_t::simdFunc(this->GetSimdVec(), static_cast<int>(param));\
+			return result;\
+		}\
+		if constexpr (Traits0_t::opeDim >= 1) { result.elements[0] = this->elements[Traits0_t::i0] OP param; }\
+		if constexpr (Traits0_t::opeDim >= 2) { result.elements[1] = this->elements[Traits0_t::i1] OP param; }\
+		if constexpr (Traits0_t::opeDim >= 3) { result.elements[2] = this->elements[Traits0_t::i2] OP param; }\
+		if constexpr (Traits0_t::opeDim >= 4) { result.elements[3] = this->elements[Traits0_t::i3] OP param; }\
+		return result;\
+	}\
+
+/* シフトと代入（全成分共通のシフト量）*/
+#define IMPL_VEC_COMPOUND_ASSIGNMENT_SHIFT_OPERATOR_WITH_SCALAR(OP, simdFunc)\
+	inline This_t& operator OP##=(\
+		const Element0_t param\
+	){\
+		static_assert(Traits0_t::isValid);\
+		if constexpr (isSimdPath) {\
+			this->simdVec = SimdVecTraits_t::simdFunc(this->simdVec, static_cast<int>(param));\
+			return *this;\
+		} else if constexpr (SimdVecTraits_t::isSimd) {\
+			/* 書き込み対象の成分のみ差し替える */\
+			this->simdVec = SimdVecTraits_t::template Blend<Traits0_t::writeMask>(\
+				this->simdVec, SimdVecTraits_t::simdFunc(this->simdVec, static_cast<int>(param))\
+			);\
+			return *this;\
+		}\
+		if constexpr (Traits0_t::opeDim >= 1) { this->elements[Traits0_t::i0] OP##= param; }\
+		if constexpr (Traits0_t::opeDim >= 2) { this->elements[Traits0_t::i1] OP##= param; }\
+		if constexpr (Traits0_t::opeDim >= 3) { this->elements[Traits0_t::i2] OP##= param; }\
+		if constexpr (Traits0_t::opeDim >= 4) { this->elements[Traits0_t::i3] OP##= param; }\
+		return *this;\
+	}\
+
 /* 二項演算（行列専用）*/
 #define IMPL_VEC_BINARY_OPERATOR_WITH_MATRIX()\
 	/* 変換（行列の SWIZZLE 変換を伴う）*/\
@@ -362,7 +2490,7 @@ struct GenSimdVecTraits<double, 4> {
 										□□□□\
 	*/\
 	template<int opeDimC1, int memDimC1, int memDimR1, int recursiveCount1>\
-	inline GenVec<Element0_t, opeDimC1>\
+	inline GenVec2<Element0_t, opeDimC1, (opeDimC1 == Traits0_t::opeDim)? Traits0_t::tempMemDim : opeDimC1>\
 	operator*(\
 		const Mat<\
 			Element0_t,\
@@ -371,8 +2499,48 @@ struct GenSimdVecTraits<double, 4> {
 			recursiveCount1\
 		> &rParam\
 	) const {\
-		GenVec<Element0_t, opeDimC1> result;\
+		/* 結果のメモリ次元数（正方行列による変換ではパディングを保つ）*/\
+		enum { resultMemDim = (opeDimC1 == Traits0_t::opeDim)? Traits0_t::tempMemDim : opeDimC1 };\
+		GenVec2<Element0_t, opeDimC1, resultMemDim> result;\
 		static_assert(Traits0_t::isValid);\
+		if constexpr (\
+			std::is_floating_point_v<Element0_t>\
+		&&	isSimdReadPath\
+		&&	Traits0_t::memDim == 4\
+		&&	memDimR1 == 4\
+		) {\
+			/* 各列との積を 4x4 転置して足し合わせ、列ごとの内積を 1 本のレジスタに並べる */\
+			typename SimdVecTraits_t::IntrinsicType_t aColumn[opeDimC1];\
+			if constexpr (opeDimC1 >= 1) { aColumn[0] = rParam.columns[0].simdVec; }\
+			if constexpr (opeDimC1 >= 2) { aColumn[1] = rParam.columns[1].simdVec; }\
+			if constexpr (opeDimC1 >= 3) { aColumn[2] = rParam.columns[2].simdVec; }\
+			if constexpr (opeDimC1 >= 4) { aColumn[3] = rParam.columns[3].simdVec; }\
+			auto simdVec = SimdVecTraits_t::template DotColumns<Traits0_t::opeDim, opeDimC1>(this->GetSimdVec(), aColumn);\
+			if constexpr (resultMemDim == 4) {\
+				result.simdVec = simdVec;\
+			} else {\
+				SimdVecTraits_t::template StorePartial<opeDimC1>(result.elements, simdVec);\
+			}\
+			return result;\
+		} else if constexpr (\
+			Traits0_t::opeDim == 2\
+		&&	opeDimC1 == 2\
+		&&	GenSimdMatTraits<Element0_t, memDimC1, memDimR1>::isSimd\
+		&&	memDimC1 == 2\
+		&&	memDimR1 == 2\
+		) {\
+			/* v * M = transpose(M) * v */\
+			using MatSimdVecTraits_t = typename GenSimdMatTraits<Element0_t, memDimC1, memDimR1>::SimdVecTraits_t;\
+			const Element0_t aTmp[2] = { this->elements[Traits0_t::i0], this->elements[Traits0_t::i1] };\
+			MatSimdVecTraits_t::template StorePartial<2>(\
+				result.elements,\
+				MatSimdVecTraits_t::Transform2x2(\
+					MatSimdVecTraits_t::Transpose2x2(rParam.simdMat),\
+					MatSimdVecTraits_t::template LoadPartial<2>(aTmp)\
+				)\
+			);\
+			return result;\
+		}\
 		if constexpr (opeDimC1 >= 1) {\
 			Element0_t tmp;\
 			if constexpr (Traits0_t::opeDim >= 1) { tmp =  this->elements[Traits0_t::i0] * rParam.columns[0][0]; }\
@@ -459,6 +2627,15 @@ struct GenSimdVecTraits<double, 4> {
 		const Temp_t &rParam\
 	) const {\
 		static_assert(Traits0_t::isValid);\
+		if constexpr (isSimdReadPath) {\
+			/* 最下位の不一致成分で大小を決める */\
+			typename SimdVecTraits_t::IntrinsicType_t simdVec0 = this->GetSimdVec();\
+			int ltBits = SimdVecTraits_t::MoveMask(SimdVecTraits_t::CmpLt(simdVec0, rParam.simdVec));\
+			int gtBits = SimdVecTraits_t::MoveMask(SimdVecTraits_t::CmpGt(simdVec0, rParam.simdVec));\
+			int diffBits = (ltBits | gtBits) & ((1 << Traits0_t::opeDim) - 1);\
+			if (diffBits == 0) { return 0; }\
+			return (ltBits & diffBits & -diffBits)? -1 : 1;\
+		}\
 		if constexpr (Traits0_t::opeDim >= 1) {\
 			if (this->elements[Traits0_t::i0] < rParam.elements[0]) { return -1; }\
 			if (this->elements[Traits0_t::i0] > rParam.elements[0]) { return 1; }\
@@ -495,13 +2672,12 @@ struct GenSimdVecTraits<double, 4> {
 	inline This_t& operator=(const This_t &rParam){\
 		static_assert(Traits0_t::isValid);\
 		static_assert(Traits0_t::hasDuplicatedMember == 0);\
-		if constexpr (SimdVecTraits_t::isM128 && Traits0_t::opeDim == 4) {\
-			__m128 tmp = rParam.simdVec;\
-			this->simdVec = tmp;\
-		} else\
-		if constexpr (SimdVecTraits_t::isM256 && Traits0_t::opeDim == 4) {\
-			__m256 tmp = rParam.simdVec;\
+		if constexpr (SimdVecTraits_t::isSimd && Traits0_t::opeDim == Traits0_t::memDim) {\
+			typename SimdVecTraits_t::IntrinsicType_t tmp = rParam.simdVec;\
 			this->simdVec = tmp;\
+		} else if constexpr (SimdVecTraits_t::isSimd) {\
+			/* rParam は同じ SWIZZLE を持つので、書き込み対象の成分のみ差し替える */\
+			this->simdVec = SimdVecTraits_t::template Blend<Traits0_t::writeMask>(this->simdVec, rParam.simdVec);\
 		} else {\
 			if constexpr (Traits0_t::opeDim >= 1) { this->elements[Traits0_t::i0] = rParam.elements[Traits0_t::i0]; }\
 			if constexpr (Traits0_t::opeDim >= 2) { this->elements[Traits0_t::i1] = rParam.elements[Traits0_t::i1]; }\
@@ -523,6 +2699,7 @@ struct GenSimdVecTraits<double, 4> {
 		if constexpr (Traits0_t::opeDim >= 2) { this->elements[Traits0_t::i1] = aParam[1]; }\
 		if constexpr (Traits0_t::opeDim >= 3) { this->elements[Traits0_t::i2] = aParam[2]; }\
 		if constexpr (Traits0_t::opeDim >= 4) { this->elements[Traits0_t::i3] = aParam[3]; }\
+		this->ClearPadding();\
 	}\
 \
 	/* キャスト（暗黙に行われる成分型と SWIZZLE の変換）*/\
@@ -545,10 +2722,42 @@ struct GenSimdVecTraits<double, 4> {
 		>;\
 		static_assert(Traits0_t::isValid && Traits1_t::isValid);\
 		static_assert(Traits0_t::hasDuplicatedMember == 0);\
+		if constexpr (\
+			std::is_same_v<Element0_t, Element1_t>\
+		&&	isSimdPath\
+		&&	SimdPath<Element1_t, Traits1_t>::isReadable\
+		) {\
+			this->simdVec = rParam.GetSimdVec();\
+			return;\
+		} else if constexpr (SimdVecTraits_t::isSimd) {\
+			/* SWIZZLE 解決済みの値を、SWIZZLE の逆変換でメモリ上の成分位置へ並べ替える */\
+			typename SimdVecTraits_t::IntrinsicType_t simdVec1;\
+			if constexpr (\
+				std::is_same_v<Element0_t, Element1_t>\
+			&&	memDim1 == Traits0_t::memDim\
+			&&	SimdPath<Element1_t, Traits1_t>::isReadable\
+			) {\
+				simdVec1 = rParam.GetSimdVec();\
+			} else {\
+				Element0_t aTmp[Traits0_t::opeDim];\
+				if constexpr (Traits0_t::opeDim >= 1) { aTmp[0] = rParam.elements[Traits1_t::i0]; }\
+				if constexpr (Traits0_t::opeDim >= 2) { aTmp[1] = rParam.elements[Traits1_t::i1]; }\
+				if constexpr (Traits0_t::opeDim >= 3) { aTmp[2] = rParam.elements[Traits1_t::i2]; }\
+				if constexpr (Traits0_t::opeDim >= 4) { aTmp[3] = rParam.elements[Traits1_t::i3]; }\
+				simdVec1 = SimdVecTraits_t::template LoadPartial<Traits0_t::opeDim>(aTmp);\
+			}\
+			if constexpr (Traits0_t::isIdentitySwizzle) {\
+				this->simdVec = simdVec1;\
+			} else {\
+				this->simdVec = SimdVecTraits_t::template Swizzle<Traits0_t::inverseSwizzle>(simdVec1);\
+			}\
+			return;\
+		}\
 		if constexpr (Traits0_t::opeDim >= 1) { this->elements[Traits0_t::i0] = rParam.elements[Traits1_t::i0]; }\
 		if constexpr (Traits0_t::opeDim >= 2) { this->elements[Traits0_t::i1] = rParam.elements[Traits1_t::i1]; }\
 		if constexpr (Traits0_t::opeDim >= 3) { this->elements[Traits0_t::i2] = rParam.elements[Traits1_t::i2]; }\
 		if constexpr (Traits0_t::opeDim >= 4) { this->elements[Traits0_t::i3] = rParam.elements[Traits1_t::i3]; }\
+		this->ClearPadding();\
 	}\
 \
 	/* キャスト（暗黙に行われるスカラからのキャスト）*/\
@@ -557,10 +2766,21 @@ struct GenSimdVecTraits<double, 4> {
 	){\
 		static_assert(Traits0_t::isValid);\
 		static_assert(Traits0_t::hasDuplicatedMember == 0);\
+		if constexpr (SimdVecTraits_t::isSimd && Traits0_t::isPadded) {\
+			/* パディング成分は 0 にする */\
+			this->simdVec = SimdVecTraits_t::template Blend<Traits0_t::writeMask>(\
+				SimdVecTraits_t::Set1(Element0_t(0)), SimdVecTraits_t::Set1(param)\
+			);\
+			return;\
+		} else if constexpr (SimdVecTraits_t::isSimd) {\
+			this->simdVec = SimdVecTraits_t::Set1(param);\
+			return;\
+		}\
 		if constexpr (Traits0_t::opeDim >= 1) { this->elements[Traits0_t::i0] = param; }\
 		if constexpr (Traits0_t::opeDim >= 2) { this->elements[Traits0_t::i1] = param; }\
 		if constexpr (Traits0_t::opeDim >= 3) { this->elements[Traits0_t::i2] = param; }\
 		if constexpr (Traits0_t::opeDim >= 4) { this->elements[Traits0_t::i3] = param; }\
+		this->ClearPadding();\
 	}\
 
 /* コンストラクタ & デストラクタ */
@@ -571,10 +2791,15 @@ struct GenSimdVecTraits<double, 4> {
 	){\
 		static_assert(Traits0_t::isValid);\
 		static_assert(Traits0_t::hasDuplicatedMember == 0);\
+		if constexpr (SimdVecTraits_t::isSimd) {\
+			this->simdVec = rParam.simdVec;\
+			return;\
+		}\
 		if constexpr (Traits0_t::opeDim >= 1) { this->elements[Traits0_t::i0] = rParam.elements[Traits0_t::i0]; }\
 		if constexpr (Traits0_t::opeDim >= 2) { this->elements[Traits0_t::i1] = rParam.elements[Traits0_t::i1]; }\
 		if constexpr (Traits0_t::opeDim >= 3) { this->elements[Traits0_t::i2] = rParam.elements[Traits0_t::i2]; }\
 		if constexpr (Traits0_t::opeDim >= 4) { this->elements[Traits0_t::i3] = rParam.elements[Traits0_t::i3]; }\
+		this->ClearPadding();\
 	}\
 \
 	/* コンストラクタ（4 次元）*/\
@@ -605,6 +2830,7 @@ struct GenSimdVecTraits<double, 4> {
 		this->elements[Traits0_t::i0] = param0;\
 		this->elements[Traits0_t::i1] = param1;\
 		this->elements[Traits0_t::i2] = param2;\
+		this->ClearPadding();\
 	}\
 \
 	/* コンストラクタ（2 次元）*/\
@@ -617,6 +2843,7 @@ struct GenSimdVecTraits<double, 4> {
 		static_assert(Traits0_t::opeDim == 2);\
 		this->elements[Traits0_t::i0] = param0;\
 		this->elements[Traits0_t::i1] = param1;\
+		this->ClearPadding();\
 	}\
 \
 	/* コンストラクタ vec4(vec3(0,1,2),3) */\
@@ -717,6 +2944,7 @@ struct GenSimdVecTraits<double, 4> {
 		this->elements[Traits0_t::i0] = rParam01.elements[0];\
 		this->elements[Traits0_t::i1] = rParam01.elements[1];\
 		this->elements[Traits0_t::i2] = param2;\
+		this->ClearPadding();\
 	}\
 \
 	/* コンストラクタ vec3(0,vec2(0,1)) */\
@@ -730,6 +2958,7 @@ struct GenSimdVecTraits<double, 4> {
 		this->elements[Traits0_t::i0] = param0;\
 		this->elements[Traits0_t::i1] = rParam12.elements[0];\
 		this->elements[Traits0_t::i2] = rParam12.elements[1];\
+		this->ClearPadding();\
 	}\
 \
 	/* コンストラクタ (次数下げ 1) */\
@@ -739,9 +2968,19 @@ struct GenSimdVecTraits<double, 4> {
 		static_assert(Traits0_t::isValid);\
 		static_assert(Traits0_t::hasDuplicatedMember == 0);\
 		static_assert(Traits0_t::opeDim <= 3);\
+		if constexpr (\
+			Traits0_t::isPadded\
+		&&	Traits0_t::memDim == Traits0_t::opeDim + 1\
+		&&	SimdPath<Element0_t, Traits<Traits0_t::memDim, Traits0_t::memDim, 0x3210>>::isEnabled\
+		) {\
+			/* 上位の成分をパディングとして 0 クリアする */\
+			this->simdVec = SimdVecTraits_t::template Blend<Traits0_t::writeMask>(SimdVecTraits_t::Set1(Element0_t(0)), rParam.simdVec);\
+			return;\
+		}\
 		if constexpr (Traits0_t::opeDim >= 1) { this->elements[Traits0_t::i0] = rParam.elements[0]; }\
 		if constexpr (Traits0_t::opeDim >= 2) { this->elements[Traits0_t::i1] = rParam.elements[1]; }\
 		if constexpr (Traits0_t::opeDim >= 3) { this->elements[Traits0_t::i2] = rParam.elements[2]; }\
+		this->ClearPadding();\
 	}\
 \
 	/* コンストラクタ (次数下げ 2) */\
@@ -753,6 +2992,7 @@ struct GenSimdVecTraits<double, 4> {
 		static_assert(Traits0_t::opeDim <= 2);\
 		if constexpr (Traits0_t::opeDim >= 1) { this->elements[Traits0_t::i0] = rParam.elements[0]; }\
 		if constexpr (Traits0_t::opeDim >= 2) { this->elements[Traits0_t::i1] = rParam.elements[1]; }\
+		this->ClearPadding();\
 	}\
 \
 	/* コンストラクタ (次数下げ 3) */\
@@ -763,11 +3003,13 @@ struct GenSimdVecTraits<double, 4> {
 		static_assert(Traits0_t::hasDuplicatedMember == 0);\
 		static_assert(Traits0_t::opeDim <= 1);\
 		if constexpr (Traits0_t::opeDim >= 1) { this->elements[Traits0_t::i0] = rParam.elements[0]; }\
+		this->ClearPadding();\
 	}\
 \
-	/* デフォルトコンストラクタ */\
+	/* デフォルトコンストラクタ（パディング成分のみ 0 で埋める）*/\
 	inline Type_t<Element0_t, Traits0_t, recursiveCount0>(\
 	){\
+		this->ClearPadding();\
 	}\
 \
 	/* デストラクタ */\
@@ -776,16 +3018,24 @@ struct GenSimdVecTraits<double, 4> {
 	}\
 
 /* 非メンバオペレータ */
-#define IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Type_t, OP)\
+#define IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Type_t, OP, simdFunc)\
 	/* スカラとの乗算：二項（第一引数がスカラの場合）*/\
 	template<typename Element_t, int opeDim, int memDim1, int swizzle1, int recursiveCount1>\
-	static inline Gen##Type_t<Element_t, opeDim>\
+	static inline Gen##Type_t##2<Element_t, opeDim, Traits<opeDim, memDim1, swizzle1>::tempMemDim>\
 	operator OP(\
 		const Element_t param0,\
 		const Type_t<Element_t, Traits<opeDim, memDim1, swizzle1>, recursiveCount1> &rParam1\
 	){\
 		using Traits1_t = Traits<opeDim, memDim1, swizzle1>;\
-		Gen##Type_t<Element_t, opeDim> result;\
+		using SimdVecTraits1_t = GenSimdVecTraits<Element_t, memDim1>;\
+		Gen##Type_t##2<Element_t, opeDim, Traits1_t::tempMemDim> result;\
+		if constexpr (SimdPath<Element_t, Traits1_t>::isReadable) {\
+			result.simdVec = SimdVecTraits1_t::simdFunc(\
+				SimdPath<Element_t, Traits1_t>::template Set1Operand<0>(param0),\
+				SimdPath<Element_t, Traits1_t>::template PadOperand<PaddingOperand_##simdFunc>(rParam1.GetSimdVec())\
+			);\
+			return result;\
+		}\
 		if constexpr (opeDim >= 1) { result.elements[0] = param0 OP rParam1.elements[Traits1_t::i0]; }\
 		if constexpr (opeDim >= 2) { result.elements[1] = param0 OP rParam1.elements[Traits1_t::i1]; }\
 		if constexpr (opeDim >= 3) { result.elements[2] = param0 OP rParam1.elements[Traits1_t::i2]; }\
@@ -795,13 +3045,21 @@ struct GenSimdVecTraits<double, 4> {
 \
 	/* スカラとの乗算：二項（第一引数が ScalarInVec の場合）*/\
 	template<typename Element_t, int memDim0, int index0, int opeDim, int memDim1, int swizzle1, int recursiveCount1>\
-	static inline Gen##Type_t<Element_t, opeDim>\
+	static inline Gen##Type_t##2<Element_t, opeDim, Traits<opeDim, memDim1, swizzle1>::tempMemDim>\
 	operator OP(\
 		const ScalarInVec<Element_t, memDim0, index0> &rParam0,\
 		const Type_t<Element_t, Traits<opeDim, memDim1, swizzle1>, recursiveCount1> &rParam1\
 	){\
 		using Traits1_t = Traits<opeDim, memDim1, swizzle1>;\
-		Gen##Type_t<Element_t, opeDim> result;\
+		using SimdVecTraits1_t = GenSimdVecTraits<Element_t, memDim1>;\
+		Gen##Type_t##2<Element_t, opeDim, Traits1_t::tempMemDim> result;\
+		if constexpr (SimdPath<Element_t, Traits1_t>::isReadable) {\
+			result.simdVec = SimdVecTraits1_t::simdFunc(\
+				SimdPath<Element_t, Traits1_t>::template Set1Operand<0>(rParam0),\
+				SimdPath<Element_t, Traits1_t>::template PadOperand<PaddingOperand_##simdFunc>(rParam1.GetSimdVec())\
+			);\
+			return result;\
+		}\
 		if constexpr (opeDim >= 1) { result.elements[0] = rParam0 OP rParam1.elements[Traits1_t::i0]; }\
 		if constexpr (opeDim >= 2) { result.elements[1] = rParam0 OP rParam1.elements[Traits1_t::i1]; }\
 		if constexpr (opeDim >= 3) { result.elements[2] = rParam0 OP rParam1.elements[Traits1_t::i2]; }\
@@ -836,7 +3094,7 @@ struct GenSimdVecTraits<double, 4> {
 ▼	浮動小数ベクトルクラス
 -----------------------------------------------------------------------------*/
 template<typename Element0_t, typename Traits0_t, int recursiveCount0>
-union Vec {
+union GLSLMATH_MAY_ALIAS Vec {
 	/* 共通部分 */
 	IMPL_VEC_COMMON(Vec);
 
@@ -847,27 +3105,27 @@ union Vec {
 	IMPL_VEC_ARRAY_SUBSCRIPT_OPERATOR();
 
 	/* 単項演算 */
-	IMPL_VEC_UNARY_OPERATOR(+);
-	IMPL_VEC_UNARY_OPERATOR(-);
+	IMPL_VEC_UNARY_OPERATOR(+, Pos);
+	IMPL_VEC_UNARY_OPERATOR(-, Neg);
 
 	/* 二項演算 */
-	IMPL_VEC_BINARY_OPERATOR(+);
-	IMPL_VEC_BINARY_OPERATOR(-);
-	IMPL_VEC_BINARY_OPERATOR(*);
-	IMPL_VEC_BINARY_OPERATOR(/);
-	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(+);
-	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(-);
-	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(*);
+	IMPL_VEC_BINARY_OPERATOR(+, Add);
+	IMPL_VEC_BINARY_OPERATOR(-, Sub);
+	IMPL_VEC_BINARY_OPERATOR(*, Mul);
+	IMPL_VEC_BINARY_OPERATOR(/, Div);
+	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(+, Add);
+	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(-, Sub);
+	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(*, Mul);
 	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR_DIV_FAST_PATH();
 
 	/* 二項演算と代入 */
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(+);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(-);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(*);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(/);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(+);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(-);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(*);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(+, Add);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(-, Sub);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(*, Mul);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(/, Div);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(+, Add);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(-, Sub);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(*, Mul);
 	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR_DIV_FAST_PATH();
 
 	/* 行列が関与する演算 */
@@ -906,7 +3164,7 @@ union Vec {
 
 /* 再帰ストッパ */
 template<typename Element0_t, typename Traits0_t>
-union Vec<Element0_t, Traits0_t, 1>{
+union GLSLMATH_MAY_ALIAS Vec<Element0_t, Traits0_t, 1>{
 	enum { recursiveCount0 = 1 };
 
 	/* 共通部分 */
@@ -916,27 +3174,27 @@ union Vec<Element0_t, Traits0_t, 1>{
 	IMPL_VEC_ARRAY_SUBSCRIPT_OPERATOR();
 
 	/* 単項演算 */
-	IMPL_VEC_UNARY_OPERATOR(+);
-	IMPL_VEC_UNARY_OPERATOR(-);
+	IMPL_VEC_UNARY_OPERATOR(+, Pos);
+	IMPL_VEC_UNARY_OPERATOR(-, Neg);
 
 	/* 二項演算 */
-	IMPL_VEC_BINARY_OPERATOR(+);
-	IMPL_VEC_BINARY_OPERATOR(-);
-	IMPL_VEC_BINARY_OPERATOR(*);
-	IMPL_VEC_BINARY_OPERATOR(/);
-	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(+);
-	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(-);
-	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(*);
+	IMPL_VEC_BINARY_OPERATOR(+, Add);
+	IMPL_VEC_BINARY_OPERATOR(-, Sub);
+	IMPL_VEC_BINARY_OPERATOR(*, Mul);
+	IMPL_VEC_BINARY_OPERATOR(/, Div);
+	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(+, Add);
+	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(-, Sub);
+	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(*, Mul);
 	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR_DIV_FAST_PATH();
 
 	/* 二項演算と代入 */
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(+);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(-);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(*);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(/);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(+);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(-);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(*);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(+, Add);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(-, Sub);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(*, Mul);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(/, Div);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(+, Add);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(-, Sub);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(*, Mul);
 	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR_DIV_FAST_PATH();
 
 	/* 行列が関与する演算 */
@@ -959,10 +3217,10 @@ union Vec<Element0_t, Traits0_t, 1>{
 };
 
 /* 非メンバ二項演算子 */
-IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Vec, +);
-IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Vec, -);
-IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Vec, *);
-IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Vec, /);
+IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Vec, +, Add);
+IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Vec, -, Sub);
+IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Vec, *, Mul);
+IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Vec, /, Div);
 
 /* & 演算子 */
 IMPL_VEC_NON_MEMBER_ADDRESS_OF_OPERATOR(Vec);
@@ -972,7 +3230,7 @@ IMPL_VEC_NON_MEMBER_ADDRESS_OF_OPERATOR(Vec);
 ▼	整数ベクトルクラス
 -----------------------------------------------------------------------------*/
 template<typename Element0_t, typename Traits0_t, int recursiveCount0>
-union Ivec {
+union GLSLMATH_MAY_ALIAS Ivec {
 	/* 共通部分 */
 	IMPL_VEC_COMMON(Ivec);
 
@@ -983,39 +3241,43 @@ union Ivec {
 	IMPL_VEC_ARRAY_SUBSCRIPT_OPERATOR();
 
 	/* 単項演算 */
-	IMPL_VEC_UNARY_OPERATOR(+);
-	IMPL_VEC_UNARY_OPERATOR(-);
-	IMPL_VEC_UNARY_OPERATOR(~);
+	IMPL_VEC_UNARY_OPERATOR(+, Pos);
+	IMPL_VEC_UNARY_OPERATOR(-, Neg);
+	IMPL_VEC_UNARY_OPERATOR(~, Not);
 
 	/* 二項演算 */
-	IMPL_VEC_BINARY_OPERATOR(+);
-	IMPL_VEC_BINARY_OPERATOR(-);
-	IMPL_VEC_BINARY_OPERATOR(*);
-	IMPL_VEC_BINARY_OPERATOR(/);
-	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(+);
-	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(-);
-	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(*);
-	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(/);	/* Ivec では FAST_PATH は利用不可 */
-	IMPL_VEC_BINARY_OPERATOR(&);
-	IMPL_VEC_BINARY_OPERATOR(|);
-	IMPL_VEC_BINARY_OPERATOR(^);
-	IMPL_VEC_BINARY_OPERATOR(<<);
-	IMPL_VEC_BINARY_OPERATOR(>>);
+	IMPL_VEC_BINARY_OPERATOR(+, Add);
+	IMPL_VEC_BINARY_OPERATOR(-, Sub);
+	IMPL_VEC_BINARY_OPERATOR(*, Mul);
+	IMPL_VEC_BINARY_OPERATOR(/, Div);
+	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(+, Add);
+	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(-, Sub);
+	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(*, Mul);
+	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(/, Div);	/* Ivec では FAST_PATH は利用不可 */
+	IMPL_VEC_BINARY_OPERATOR(&, And);
+	IMPL_VEC_BINARY_OPERATOR(|, Or);
+	IMPL_VEC_BINARY_OPERATOR(^, Xor);
+	IMPL_VEC_BINARY_OPERATOR(<<, ShiftLeft);
+	IMPL_VEC_BINARY_OPERATOR(>>, ShiftRight);
+	IMPL_VEC_SHIFT_OPERATOR_WITH_SCALAR(<<, ShiftLeftScalar);
+	IMPL_VEC_SHIFT_OPERATOR_WITH_SCALAR(>>, ShiftRightScalar);
 
 	/* 二項演算と代入 */
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(+);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(-);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(*);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(/);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(+);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(-);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(*);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(/);	/* Ivec では FAST_PATH は利用不可 */
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(&);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(|);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(^);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(<<);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(>>);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(+, Add);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(-, Sub);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(*, Mul);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(/, Div);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(+, Add);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(-, Sub);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(*, Mul);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(/, Div);	/* Ivec では FAST_PATH は利用不可 */
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(&, And);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(|, Or);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(^, Xor);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(<<, ShiftLeft);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(>>, ShiftRight);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_SHIFT_OPERATOR_WITH_SCALAR(<<, ShiftLeftScalar);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_SHIFT_OPERATOR_WITH_SCALAR(>>, ShiftRightScalar);
 
 	/* 行列が関与する演算 */
 	IMPL_VEC_BINARY_OPERATOR_WITH_MATRIX();
@@ -1053,7 +3315,7 @@ union Ivec {
 
 /* 再帰ストッパ */
 template<typename Element0_t, typename Traits0_t>
-union Ivec<Element0_t, Traits0_t, 1>{
+union GLSLMATH_MAY_ALIAS Ivec<Element0_t, Traits0_t, 1>{
 	enum { recursiveCount0 = 1 };
 
 	/* 共通部分 */
@@ -1063,39 +3325,43 @@ union Ivec<Element0_t, Traits0_t, 1>{
 	IMPL_VEC_ARRAY_SUBSCRIPT_OPERATOR();
 
 	/* 単項演算 */
-	IMPL_VEC_UNARY_OPERATOR(+);
-	IMPL_VEC_UNARY_OPERATOR(-);
-	IMPL_VEC_UNARY_OPERATOR(~);
+	IMPL_VEC_UNARY_OPERATOR(+, Pos);
+	IMPL_VEC_UNARY_OPERATOR(-, Neg);
+	IMPL_VEC_UNARY_OPERATOR(~, Not);
 
 	/* 二項演算 */
-	IMPL_VEC_BINARY_OPERATOR(+);
-	IMPL_VEC_BINARY_OPERATOR(-);
-	IMPL_VEC_BINARY_OPERATOR(*);
-	IMPL_VEC_BINARY_OPERATOR(/);
-	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(+);
-	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(-);
-	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(*);
-	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(/);	/* Ivec では FAST_PATH は利用不可 */
-	IMPL_VEC_BINARY_OPERATOR(&);
-	IMPL_VEC_BINARY_OPERATOR(|);
-	IMPL_VEC_BINARY_OPERATOR(^);
-	IMPL_VEC_BINARY_OPERATOR(<<);
-	IMPL_VEC_BINARY_OPERATOR(>>);
+	IMPL_VEC_BINARY_OPERATOR(+, Add);
+	IMPL_VEC_BINARY_OPERATOR(-, Sub);
+	IMPL_VEC_BINARY_OPERATOR(*, Mul);
+	IMPL_VEC_BINARY_OPERATOR(/, Div);
+	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(+, Add);
+	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(-, Sub);
+	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(*, Mul);
+	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(/, Div);	/* Ivec では FAST_PATH は利用不可 */
+	IMPL_VEC_BINARY_OPERATOR(&, And);
+	IMPL_VEC_BINARY_OPERATOR(|, Or);
+	IMPL_VEC_BINARY_OPERATOR(^, Xor);
+	IMPL_VEC_BINARY_OPERATOR(<<, ShiftLeft);
+	IMPL_VEC_BINARY_OPERATOR(>>, ShiftRight);
+	IMPL_VEC_SHIFT_OPERATOR_WITH_SCALAR(<<, ShiftLeftScalar);
+	IMPL_VEC_SHIFT_OPERATOR_WITH_SCALAR(>>, ShiftRightScalar);
 
 	/* 二項演算と代入 */
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(+);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(-);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(*);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(/);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(+);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(-);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(*);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(/);	/* Ivec では FAST_PATH は利用不可 */
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(&);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(|);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(^);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(<<);
-	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(>>);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(+, Add);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(-, Sub);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(*, Mul);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(/, Div);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(+, Add);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(-, Sub);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(*, Mul);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(/, Div);	/* Ivec では FAST_PATH は利用不可 */
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(&, And);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(|, Or);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(^, Xor);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(<<, ShiftLeft);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_OPERATOR(>>, ShiftRight);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_SHIFT_OPERATOR_WITH_SCALAR(<<, ShiftLeftScalar);
+	IMPL_VEC_COMPOUND_ASSIGNMENT_SHIFT_OPERATOR_WITH_SCALAR(>>, ShiftRightScalar);
 
 	/* 行列が関与する演算 */
 	IMPL_VEC_BINARY_OPERATOR_WITH_MATRIX();
@@ -1117,15 +3383,15 @@ union Ivec<Element0_t, Traits0_t, 1>{
 };
 
 /* 非メンバ二項演算子 */
-IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Ivec, +);
-IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Ivec, -);
-IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Ivec, *);
-IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Ivec, /);
-IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Ivec, &);
-IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Ivec, |);
-IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Ivec, ^);
-IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Ivec, <<);
-IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Ivec, >>);
+IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Ivec, +, Add);
+IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Ivec, -, Sub);
+IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Ivec, *, Mul);
+IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Ivec, /, Div);
+IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Ivec, &, And);
+IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Ivec, |, Or);
+IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Ivec, ^, Xor);
+IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Ivec, <<, ShiftLeft);
+IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Ivec, >>, ShiftRight);
 
 /* & 演算子 */
 IMPL_VEC_NON_MEMBER_ADDRESS_OF_OPERATOR(Ivec);
@@ -1139,7 +3405,7 @@ IMPL_VEC_NON_MEMBER_ADDRESS_OF_OPERATOR(Ivec);
 	しかし、この Element0_t は再帰ストッパの意味があるので省略できない。
 */
 template<typename Element0_t, typename Traits0_t, int recursiveCount0>
-union Bvec {
+union GLSLMATH_MAY_ALIAS Bvec {
 	/* 共通部分 */
 	IMPL_VEC_COMMON(Bvec);
 
@@ -1150,13 +3416,13 @@ union Bvec {
 	IMPL_VEC_ARRAY_SUBSCRIPT_OPERATOR();
 
 	/* 単項演算 */
-	IMPL_VEC_UNARY_OPERATOR(!);
+	IMPL_VEC_UNARY_OPERATOR(!, LogicalNot);
 
 	/* 二項演算 */
-	IMPL_VEC_BINARY_OPERATOR(&&);
-	IMPL_VEC_BINARY_OPERATOR(||);
-	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(&&);
-	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(||);
+	IMPL_VEC_BINARY_OPERATOR(&&, LogicalAnd);
+	IMPL_VEC_BINARY_OPERATOR(||, LogicalOr);
+	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(&&, LogicalAnd);
+	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(||, LogicalOr);
 
 	/* 比較演算子 */
 	IMPL_VEC_COMPARISON_OPERATOR();
@@ -1173,7 +3439,7 @@ union Bvec {
 
 /* 再帰ストッパ */
 template<typename Element0_t, typename Traits0_t>
-union Bvec<Element0_t, Traits0_t, 1>{
+union GLSLMATH_MAY_ALIAS Bvec<Element0_t, Traits0_t, 1>{
 	enum { recursiveCount0 = 1 };
 
 	/* 共通部分 */
@@ -1183,13 +3449,13 @@ union Bvec<Element0_t, Traits0_t, 1>{
 	IMPL_VEC_ARRAY_SUBSCRIPT_OPERATOR();
 
 	/* 単項演算 */
-	IMPL_VEC_UNARY_OPERATOR(!);
+	IMPL_VEC_UNARY_OPERATOR(!, LogicalNot);
 
 	/* 二項演算 */
-	IMPL_VEC_BINARY_OPERATOR(&&);
-	IMPL_VEC_BINARY_OPERATOR(||);
-	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(&&);
-	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(||);
+	IMPL_VEC_BINARY_OPERATOR(&&, LogicalAnd);
+	IMPL_VEC_BINARY_OPERATOR(||, LogicalOr);
+	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(&&, LogicalAnd);
+	IMPL_VEC_BINARY_OPERATOR_WITH_SCALAR(||, LogicalOr);
 
 	/* 比較演算子 */
 	IMPL_VEC_COMPARISON_OPERATOR();
@@ -1205,8 +3471,8 @@ union Bvec<Element0_t, Traits0_t, 1>{
 };
 
 /* 非メンバ二項演算子 */
-IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, &&);
-IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||);
+IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, &&, LogicalAnd);
+IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||, LogicalOr);
 
 
 /*=============================================================================
@@ -1225,13 +3491,109 @@ IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||);
 \
 		/* 列の型 */\
 		using Column_t = GenVec2<Element0_t, opeDimR0, memDimR0>;\
+\
+		/* 行列の型情報 */\
+		using MatTraits_t = MatTraits<opeDimC0, memDimC0, opeDimR0, memDimR0, recursiveCount0>;\
 \
 		/* 中間値の型（SWIZZLE 解決済み）*/\
-		using Temp_t = GenMat<Element0_t, opeDimC0, opeDimR0>;\
+		using Temp_t = GenMat2<Element0_t, opeDimC0, opeDimR0, MatTraits_t::tempMemDimR>;\
+\
+		/* 中間値の列の型 */\
+		using TempColumn_t = GenVec2<Element0_t, opeDimR0, MatTraits_t::tempMemDimR>;\
+\
+		/* 行列との積を取るベクトルの型 */\
+		using TempRow_t = GenVec2<Element0_t, opeDimC0, MatTraits_t::tempMemDimC>;\
+\
+		/* 列の SIMD 型 */\
+		using ColumnSimdVecTraits_t = GenSimdVecTraits<Element0_t, memDimR0>;\
+\
+		/*\
+			列単位の SIMD 演算の可否\
+			パディング付きの行列はパディング成分を破壊してよいので可。\
+			SWIZZLE メンバ（例えば mat4 の as3x3）の列の余剰成分は他の成分の実体なので不可。\
+		*/\
+		enum {\
+			isSimdColumn =\
+				SimdPath<Element0_t, Traits<opeDimR0, memDimR0, 0x3210>>::isEnabled\
+			&&	(opeDimR0 == memDimR0 || MatTraits_t::isPadded)\
+		};\
+\
+		/* 列の SIMD レジスタ型 */\
+		using ColumnIntrinsic_t = typename ColumnSimdVecTraits_t::IntrinsicType_t;\
+\
+		/* 行列全体の SIMD 型 */\
+		using MatSimdTraits_t = GenSimdMatTraits<Element0_t, memDimC0, memDimR0>;\
+		using MatSimdVecTraits_t = typename MatSimdTraits_t::SimdVecTraits_t;\
+\
+		/* 行列全体を 1 本のレジスタで演算できるか？（全成分が演算対象である場合のみ可）*/\
+		enum {\
+			isSimdMat =\
+				MatSimdTraits_t::isSimd\
+			&&	opeDimC0 == memDimC0\
+			&&	opeDimR0 == memDimR0\
+		};\
+\
+		/*\
+			ベクトルの第 i 成分を、列の SIMD 型の全成分にブロードキャスト\
+			256 bit 型では 128 bit 境界を跨ぐ並べ替えが高価なので、メモリ上の成分から\
+			ブロードキャストする（レジスタ上の値はコンパイラが並べ替えに置き換える）。\
+		*/\
+		template<int i, typename Traits1_t, int recursiveCount1>\
+		static inline auto BroadcastElement(const Vec<Element0_t, Traits1_t, recursiveCount1> &rParam){\
+			constexpr int index = (Traits1_t::swizzle >> (i * 4)) & 15;\
+			if constexpr (Traits1_t::memDim == memDimR0 && ColumnSimdVecTraits_t::isSimd && !ColumnSimdVecTraits_t::isM256) {\
+				return ColumnSimdVecTraits_t::template Swizzle<index * 0x1111>(rParam.simdVec);\
+			} else {\
+				return ColumnSimdVecTraits_t::Set1(rParam.elements[index]);\
+			}\
+		}\
+\
+		/* SIMD レジスタ上の列の線形結合 aColumn[0] * v[0] + aColumn[1] * v[1] + ... */\
+		template<typename Vec_t>\
+		static inline auto TransformColumn(\
+			const ColumnIntrinsic_t aColumn[opeDimC0],\
+			const Vec_t &rParam\
+		){\
+			ColumnIntrinsic_t acc;\
+			if constexpr (opeDimC0 >= 1) { acc = ColumnSimdVecTraits_t::Mul(aColumn[0], BroadcastElement<0>(rParam)); }\
+			if constexpr (opeDimC0 >= 2) { acc = ColumnSimdVecTraits_t::MulAdd(aColumn[1], BroadcastElement<1>(rParam), acc); }\
+			if constexpr (opeDimC0 >= 3) { acc = ColumnSimdVecTraits_t::MulAdd(aColumn[2], BroadcastElement<2>(rParam), acc); }\
+			if constexpr (opeDimC0 >= 4) { acc = ColumnSimdVecTraits_t::MulAdd(aColumn[3], BroadcastElement<3>(rParam), acc); }\
+			return acc;\
+		}\
+\
+		/*\
+			列への書き込み\
+			構築中のオブジェクトとパディング付きの行列は、列の余剰成分ごと書き込む。\
+			（SWIZZLE メンバへの代入では、列の余剰成分は他の成分の実体なので保護する）\
+		*/\
+		template<int i, bool isConstructing, typename Param_t>\
+		inline void StoreColumn(const Param_t &rParam){\
+			if constexpr ((isConstructing || MatTraits_t::isPadded) && ColumnSimdVecTraits_t::isSimd) {\
+				if constexpr (std::is_same_v<Param_t, Column_t>) {\
+					this->columns[i].simdVec = rParam.simdVec;\
+				} else {\
+					this->columns[i].simdVec = Column_t(rParam).simdVec;\
+				}\
+			} else {\
+				this->columns[i] = rParam;\
+			}\
+		}\
+\
+		/* 全列を SIMD レジスタに読み込む */\
+		inline void LoadColumns(ColumnIntrinsic_t aColumn[opeDimC0]) const {\
+			if constexpr (opeDimC0 >= 1) { aColumn[0] = this->columns[0].simdVec; }\
+			if constexpr (opeDimC0 >= 2) { aColumn[1] = this->columns[1].simdVec; }\
+			if constexpr (opeDimC0 >= 3) { aColumn[2] = this->columns[2].simdVec; }\
+			if constexpr (opeDimC0 >= 4) { aColumn[3] = this->columns[3].simdVec; }\
+		}\
 \
 	public:\
 		/* 列成分 */\
 		Column_t columns[memDimC0];\
+\
+		/* 行列全体の SIMD 型（isSimdMat の場合のみ利用可）*/\
+		typename MatSimdTraits_t::IntrinsicType_t simdMat;\
 \
 		/* this ポインタを取得 */\
 		inline       This_t * GetThisPointer()       { return this; }\
@@ -1258,9 +3620,16 @@ IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||);
 	}\
 
 /* 単項演算 */
-#define IMPL_MAT_UNARY_OPERATOR(OP)\
+#define IMPL_MAT_UNARY_OPERATOR(OP, simdFunc)\
 	inline Temp_t operator OP() const {\
 		Temp_t result;\
+		if constexpr (isSimdColumn) {\
+			if constexpr (opeDimC0 >= 1) { result.columns[0].simdVec = ColumnSimdVecTraits_t::simdFunc(this->columns[0].simdVec); }\
+			if constexpr (opeDimC0 >= 2) { result.columns[1].simdVec = ColumnSimdVecTraits_t::simdFunc(this->columns[1].simdVec); }\
+			if constexpr (opeDimC0 >= 3) { result.columns[2].simdVec = ColumnSimdVecTraits_t::simdFunc(this->columns[2].simdVec); }\
+			if constexpr (opeDimC0 >= 4) { result.columns[3].simdVec = ColumnSimdVecTraits_t::simdFunc(this->columns[3].simdVec); }\
+			return result;\
+		}\
 		if constexpr (opeDimC0 >= 1) { result.columns[0] = OP this->columns[0]; }\
 		if constexpr (opeDimC0 >= 2) { result.columns[1] = OP this->columns[1]; }\
 		if constexpr (opeDimC0 >= 3) { result.columns[2] = OP this->columns[2]; }\
@@ -1269,11 +3638,18 @@ IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||);
 	}\
 
 /* 二項演算 */
-#define IMPL_MAT_BINARY_OPERATOR(OP)\
+#define IMPL_MAT_BINARY_OPERATOR(OP, simdFunc)\
 	inline Temp_t operator OP(\
 		const Temp_t &rParam\
 	) const {\
 		Temp_t result;\
+		if constexpr (isSimdColumn) {\
+			if constexpr (opeDimC0 >= 1) { result.columns[0].simdVec = ColumnSimdVecTraits_t::simdFunc(this->columns[0].simdVec, rParam.columns[0].simdVec); }\
+			if constexpr (opeDimC0 >= 2) { result.columns[1].simdVec = ColumnSimdVecTraits_t::simdFunc(this->columns[1].simdVec, rParam.columns[1].simdVec); }\
+			if constexpr (opeDimC0 >= 3) { result.columns[2].simdVec = ColumnSimdVecTraits_t::simdFunc(this->columns[2].simdVec, rParam.columns[2].simdVec); }\
+			if constexpr (opeDimC0 >= 4) { result.columns[3].simdVec = ColumnSimdVecTraits_t::simdFunc(this->columns[3].simdVec, rParam.columns[3].simdVec); }\
+			return result;\
+		}\
 		if constexpr (opeDimC0 >= 1) { result.columns[0] = this->columns[0] OP rParam.columns[0]; }\
 		if constexpr (opeDimC0 >= 2) { result.columns[1] = this->columns[1] OP rParam.columns[1]; }\
 		if constexpr (opeDimC0 >= 3) { result.columns[2] = this->columns[2] OP rParam.columns[2]; }\
@@ -1282,11 +3658,19 @@ IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||);
 	}\
 
 /* 二項演算（スカラ）*/
-#define IMPL_MAT_BINARY_OPERATOR_WITH_SCALAR(OP)\
+#define IMPL_MAT_BINARY_OPERATOR_WITH_SCALAR(OP, simdFunc)\
 	inline Temp_t operator OP(\
 		const Element0_t param\
 	) const {\
 		Temp_t result;\
+		if constexpr (isSimdColumn) {\
+			ColumnIntrinsic_t simdParam = ColumnSimdVecTraits_t::Set1(param);\
+			if constexpr (opeDimC0 >= 1) { result.columns[0].simdVec = ColumnSimdVecTraits_t::simdFunc(this->columns[0].simdVec, simdParam); }\
+			if constexpr (opeDimC0 >= 2) { result.columns[1].simdVec = ColumnSimdVecTraits_t::simdFunc(this->columns[1].simdVec, simdParam); }\
+			if constexpr (opeDimC0 >= 3) { result.columns[2].simdVec = ColumnSimdVecTraits_t::simdFunc(this->columns[2].simdVec, simdParam); }\
+			if constexpr (opeDimC0 >= 4) { result.columns[3].simdVec = ColumnSimdVecTraits_t::simdFunc(this->columns[3].simdVec, simdParam); }\
+			return result;\
+		}\
 		if constexpr (opeDimC0 >= 1) { result.columns[0] = this->columns[0] OP param; }\
 		if constexpr (opeDimC0 >= 2) { result.columns[1] = this->columns[1] OP param; }\
 		if constexpr (opeDimC0 >= 3) { result.columns[2] = this->columns[2] OP param; }\
@@ -1295,10 +3679,17 @@ IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||);
 	}\
 
 /* 二項演算と代入 */
-#define IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR(OP)\
+#define IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR(OP, simdFunc)\
 	inline This_t& operator OP##=(\
 		const Temp_t &rParam\
 	){\
+		if constexpr (isSimdColumn) {\
+			if constexpr (opeDimC0 >= 1) { this->columns[0].simdVec = ColumnSimdVecTraits_t::simdFunc(this->columns[0].simdVec, rParam.columns[0].simdVec); }\
+			if constexpr (opeDimC0 >= 2) { this->columns[1].simdVec = ColumnSimdVecTraits_t::simdFunc(this->columns[1].simdVec, rParam.columns[1].simdVec); }\
+			if constexpr (opeDimC0 >= 3) { this->columns[2].simdVec = ColumnSimdVecTraits_t::simdFunc(this->columns[2].simdVec, rParam.columns[2].simdVec); }\
+			if constexpr (opeDimC0 >= 4) { this->columns[3].simdVec = ColumnSimdVecTraits_t::simdFunc(this->columns[3].simdVec, rParam.columns[3].simdVec); }\
+			return *this;\
+		}\
 		if constexpr (opeDimC0 >= 1) { this->columns[0] OP##= rParam.columns[0]; }\
 		if constexpr (opeDimC0 >= 2) { this->columns[1] OP##= rParam.columns[1]; }\
 		if constexpr (opeDimC0 >= 3) { this->columns[2] OP##= rParam.columns[2]; }\
@@ -1307,10 +3698,18 @@ IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||);
 	}\
 
 /* 二項演算と代入（スカラ）*/
-#define IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(OP)\
+#define IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(OP, simdFunc)\
 	inline This_t& operator OP##=(\
 		const Element0_t param\
 	){\
+		if constexpr (isSimdColumn) {\
+			ColumnIntrinsic_t simdParam = ColumnSimdVecTraits_t::Set1(param);\
+			if constexpr (opeDimC0 >= 1) { this->columns[0].simdVec = ColumnSimdVecTraits_t::simdFunc(this->columns[0].simdVec, simdParam); }\
+			if constexpr (opeDimC0 >= 2) { this->columns[1].simdVec = ColumnSimdVecTraits_t::simdFunc(this->columns[1].simdVec, simdParam); }\
+			if constexpr (opeDimC0 >= 3) { this->columns[2].simdVec = ColumnSimdVecTraits_t::simdFunc(this->columns[2].simdVec, simdParam); }\
+			if constexpr (opeDimC0 >= 4) { this->columns[3].simdVec = ColumnSimdVecTraits_t::simdFunc(this->columns[3].simdVec, simdParam); }\
+			return *this;\
+		}\
 		if constexpr (opeDimC0 >= 1) { this->columns[0] OP##= param; }\
 		if constexpr (opeDimC0 >= 2) { this->columns[1] OP##= param; }\
 		if constexpr (opeDimC0 >= 3) { this->columns[2] OP##= param; }\
@@ -1325,6 +3724,14 @@ IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||);
 	) const {\
 		Temp_t result;\
 		Element0_t invParam = 1 / param;\
+		if constexpr (isSimdColumn) {\
+			ColumnIntrinsic_t simdParam = ColumnSimdVecTraits_t::Set1(invParam);\
+			if constexpr (opeDimC0 >= 1) { result.columns[0].simdVec = ColumnSimdVecTraits_t::Mul(this->columns[0].simdVec, simdParam); }\
+			if constexpr (opeDimC0 >= 2) { result.columns[1].simdVec = ColumnSimdVecTraits_t::Mul(this->columns[1].simdVec, simdParam); }\
+			if constexpr (opeDimC0 >= 3) { result.columns[2].simdVec = ColumnSimdVecTraits_t::Mul(this->columns[2].simdVec, simdParam); }\
+			if constexpr (opeDimC0 >= 4) { result.columns[3].simdVec = ColumnSimdVecTraits_t::Mul(this->columns[3].simdVec, simdParam); }\
+			return result;\
+		}\
 		if constexpr (opeDimC0 >= 1) { result.columns[0] = this->columns[0] * invParam; }\
 		if constexpr (opeDimC0 >= 2) { result.columns[1] = this->columns[1] * invParam; }\
 		if constexpr (opeDimC0 >= 3) { result.columns[2] = this->columns[2] * invParam; }\
@@ -1338,6 +3745,14 @@ IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||);
 		const Element0_t param\
 	){\
 		Element0_t invParam = 1 / param;\
+		if constexpr (isSimdColumn) {\
+			ColumnIntrinsic_t simdParam = ColumnSimdVecTraits_t::Set1(invParam);\
+			if constexpr (opeDimC0 >= 1) { this->columns[0].simdVec = ColumnSimdVecTraits_t::Mul(this->columns[0].simdVec, simdParam); }\
+			if constexpr (opeDimC0 >= 2) { this->columns[1].simdVec = ColumnSimdVecTraits_t::Mul(this->columns[1].simdVec, simdParam); }\
+			if constexpr (opeDimC0 >= 3) { this->columns[2].simdVec = ColumnSimdVecTraits_t::Mul(this->columns[2].simdVec, simdParam); }\
+			if constexpr (opeDimC0 >= 4) { this->columns[3].simdVec = ColumnSimdVecTraits_t::Mul(this->columns[3].simdVec, simdParam); }\
+			return *this;\
+		}\
 		if constexpr (opeDimC0 >= 1) { this->columns[0] *= invParam; }\
 		if constexpr (opeDimC0 >= 2) { this->columns[1] *= invParam; }\
 		if constexpr (opeDimC0 >= 3) { this->columns[2] *= invParam; }\
@@ -1356,11 +3771,26 @@ IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||);
 			□				□□□□				■\
 			□				□□□□				□\
 	*/\
-	inline GenVec<Element0_t, opeDimR0>\
+	inline TempColumn_t\
 	operator*(\
-		const GenVec<Element0_t, opeDimC0> &rParam\
+		const TempRow_t &rParam\
 	) const {\
-		GenVec<Element0_t, opeDimR0> result;\
+		TempColumn_t result;\
+		if constexpr (isSimdMat) {\
+			/* 行列全体を 1 本のレジスタのまま変換する */\
+			MatSimdVecTraits_t::template StorePartial<opeDimR0>(\
+				result.elements,\
+				MatSimdVecTraits_t::Transform2x2(this->simdMat, MatSimdVecTraits_t::template LoadPartial<opeDimC0>(rParam.elements))\
+			);\
+			return result;\
+		}\
+		if constexpr (isSimdColumn) {\
+			/* 列を SIMD 型のまま、ブロードキャストしたベクトル成分と積和する */\
+			ColumnIntrinsic_t aColumn[opeDimC0];\
+			this->LoadColumns(aColumn);\
+			result.simdVec = TransformColumn(aColumn, rParam);\
+			return result;\
+		}\
 		if constexpr (opeDimC0 >= 1) { result =  this->columns[0] * rParam.elements[0]; }\
 		if constexpr (opeDimC0 >= 2) { result += this->columns[1] * rParam.elements[1]; }\
 		if constexpr (opeDimC0 >= 3) { result += this->columns[2] * rParam.elements[2]; }\
@@ -1389,6 +3819,21 @@ IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||);
 		> &rParam\
 	){\
 		static_assert(opeDimC0 == opeDimR0);\
+		if constexpr (isSimdColumn) {\
+			/* 全ての読み込みを書き込みより先に済ませるので、rParam が *this と同じでもよい */\
+			ColumnIntrinsic_t aColumn[opeDimC0];\
+			ColumnIntrinsic_t aResult[opeDimC0];\
+			this->LoadColumns(aColumn);\
+			if constexpr (opeDimC0 >= 1) { aResult[0] = TransformColumn(aColumn, rParam.columns[0]); }\
+			if constexpr (opeDimC0 >= 2) { aResult[1] = TransformColumn(aColumn, rParam.columns[1]); }\
+			if constexpr (opeDimC0 >= 3) { aResult[2] = TransformColumn(aColumn, rParam.columns[2]); }\
+			if constexpr (opeDimC0 >= 4) { aResult[3] = TransformColumn(aColumn, rParam.columns[3]); }\
+			if constexpr (opeDimC0 >= 1) { this->columns[0].simdVec = aResult[0]; }\
+			if constexpr (opeDimC0 >= 2) { this->columns[1].simdVec = aResult[1]; }\
+			if constexpr (opeDimC0 >= 3) { this->columns[2].simdVec = aResult[2]; }\
+			if constexpr (opeDimC0 >= 4) { this->columns[3].simdVec = aResult[3]; }\
+			return *this;\
+		}\
 		/* 入出力競合を避けるため、意図的にテンポラリオブジェクトを経由させている */\
 		*this = *this * rParam;\
 		return *this;\
@@ -1404,7 +3849,7 @@ IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||);
 								□□□□				■■■□\
 	*/\
 	template<int opeDimC1, int memDimC1, int memDimR1, int recursiveCount1>\
-	inline GenMat<Element0_t, opeDimC1, opeDimR0>\
+	inline GenMat2<Element0_t, opeDimC1, opeDimR0, MatTraits_t::tempMemDimR>\
 	operator*(\
 		const Mat<\
 			Element0_t,\
@@ -1413,9 +3858,28 @@ IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||);
 			recursiveCount1\
 		> &rParam\
 	) const {\
-		GenMat<Element0_t, opeDimC1, opeDimR0> result;\
+		GenMat2<Element0_t, opeDimC1, opeDimR0, MatTraits_t::tempMemDimR> result;\
 		static_assert(opeDimC1 <= memDimC1);	/* rParam の整合性チェック */\
 		static_assert(opeDimC0 <= memDimR1);	/* rParam の整合性チェック */\
+		if constexpr (\
+			isSimdMat\
+		&&	GenSimdMatTraits<Element0_t, memDimC1, memDimR1>::isSimd\
+		&&	opeDimC1 == memDimC1\
+		&&	opeDimC0 == memDimR1\
+		) {\
+			result.simdMat = MatSimdVecTraits_t::Mul2x2(this->simdMat, rParam.simdMat);\
+			return result;\
+		}\
+		if constexpr (isSimdColumn) {\
+			/* 左辺の列は一度だけ読み込み、SIMD レジスタに保持したまま使い回す */\
+			ColumnIntrinsic_t aColumn[opeDimC0];\
+			this->LoadColumns(aColumn);\
+			if constexpr (opeDimC1 /* opeDimC0 としない */ >= 1) { result.columns[0].simdVec = TransformColumn(aColumn, rParam.columns[0]); }\
+			if constexpr (opeDimC1 /* opeDimC0 としない */ >= 2) { result.columns[1].simdVec = TransformColumn(aColumn, rParam.columns[1]); }\
+			if constexpr (opeDimC1 /* opeDimC0 としない */ >= 3) { result.columns[2].simdVec = TransformColumn(aColumn, rParam.columns[2]); }\
+			if constexpr (opeDimC1 /* opeDimC0 としない */ >= 4) { result.columns[3].simdVec = TransformColumn(aColumn, rParam.columns[3]); }\
+			return result;\
+		}\
 		if constexpr (opeDimC1 /* opeDimC0 としない */ >= 1) { result.columns[0] = *this * rParam.columns[0]; }\
 		if constexpr (opeDimC1 /* opeDimC0 としない */ >= 2) { result.columns[1] = *this * rParam.columns[1]; }\
 		if constexpr (opeDimC1 /* opeDimC0 としない */ >= 3) { result.columns[2] = *this * rParam.columns[2]; }\
@@ -1504,10 +3968,10 @@ IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||);
 #define IMPL_MAT_ASSIGNMENT_OPERATOR()\
 	/* 代入（SWIZZLE 変換を伴わない）*/\
 	inline This_t& operator=(const This_t &rParam){\
-		if constexpr (opeDimC0 >= 1) { this->columns[0] = rParam.columns[0]; }\
-		if constexpr (opeDimC0 >= 2) { this->columns[1] = rParam.columns[1]; }\
-		if constexpr (opeDimC0 >= 3) { this->columns[2] = rParam.columns[2]; }\
-		if constexpr (opeDimC0 >= 4) { this->columns[3] = rParam.columns[3]; }\
+		if constexpr (opeDimC0 >= 1) { this->StoreColumn<0, false>(rParam.columns[0]); }\
+		if constexpr (opeDimC0 >= 2) { this->StoreColumn<1, false>(rParam.columns[1]); }\
+		if constexpr (opeDimC0 >= 3) { this->StoreColumn<2, false>(rParam.columns[2]); }\
+		if constexpr (opeDimC0 >= 4) { this->StoreColumn<3, false>(rParam.columns[3]); }\
 		return *this;\
 	}\
 
@@ -1522,10 +3986,10 @@ IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||);
 	>(\
 		const Element0_t aaParam[opeDimC0][opeDimR0]\
 	){\
-		if constexpr (opeDimC0 >= 1) { this->columns[0] = aaParam[0]; }\
-		if constexpr (opeDimC0 >= 2) { this->columns[1] = aaParam[1]; }\
-		if constexpr (opeDimC0 >= 3) { this->columns[2] = aaParam[2]; }\
-		if constexpr (opeDimC0 >= 4) { this->columns[3] = aaParam[3]; }\
+		if constexpr (opeDimC0 >= 1) { this->StoreColumn<0, true>(aaParam[0]); }\
+		if constexpr (opeDimC0 >= 2) { this->StoreColumn<1, true>(aaParam[1]); }\
+		if constexpr (opeDimC0 >= 3) { this->StoreColumn<2, true>(aaParam[2]); }\
+		if constexpr (opeDimC0 >= 4) { this->StoreColumn<3, true>(aaParam[3]); }\
 	}\
 \
 	/* キャスト（暗黙に行われる成分型と SWIZZLE の変換）*/\
@@ -1545,10 +4009,10 @@ IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||);
 	){\
 		static_assert(opeDimC0 <= memDimC1);\
 		static_assert(opeDimR0 <= memDimR1);\
-		if constexpr (opeDimC0 >= 1) { this->columns[0] = rParam.columns[0]; }\
-		if constexpr (opeDimC0 >= 2) { this->columns[1] = rParam.columns[1]; }\
-		if constexpr (opeDimC0 >= 3) { this->columns[2] = rParam.columns[2]; }\
-		if constexpr (opeDimC0 >= 4) { this->columns[3] = rParam.columns[3]; }\
+		if constexpr (opeDimC0 >= 1) { this->StoreColumn<0, true>(rParam.columns[0]); }\
+		if constexpr (opeDimC0 >= 2) { this->StoreColumn<1, true>(rParam.columns[1]); }\
+		if constexpr (opeDimC0 >= 3) { this->StoreColumn<2, true>(rParam.columns[2]); }\
+		if constexpr (opeDimC0 >= 4) { this->StoreColumn<3, true>(rParam.columns[3]); }\
 	}\
 \
 	/* キャスト（暗黙に行われるスカラからのキャスト）*/\
@@ -1560,10 +4024,10 @@ IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||);
 	>(\
 		const Element0_t param\
 	){\
-		if constexpr (opeDimC0 >= 1) { this->columns[0] = param; }\
-		if constexpr (opeDimC0 >= 2) { this->columns[1] = param; }\
-		if constexpr (opeDimC0 >= 3) { this->columns[2] = param; }\
-		if constexpr (opeDimC0 >= 4) { this->columns[3] = param; }\
+		if constexpr (opeDimC0 >= 1) { this->StoreColumn<0, true>(param); }\
+		if constexpr (opeDimC0 >= 2) { this->StoreColumn<1, true>(param); }\
+		if constexpr (opeDimC0 >= 3) { this->StoreColumn<2, true>(param); }\
+		if constexpr (opeDimC0 >= 4) { this->StoreColumn<3, true>(param); }\
 	}\
 
 /* コンストラクタ & デストラクタ */
@@ -1577,10 +4041,10 @@ IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||);
 	>(\
 		const This_t &rParam\
 	){\
-		if constexpr (opeDimC0 >= 1) { this->columns[0] = rParam.columns[0]; }\
-		if constexpr (opeDimC0 >= 2) { this->columns[1] = rParam.columns[1]; }\
-		if constexpr (opeDimC0 >= 3) { this->columns[2] = rParam.columns[2]; }\
-		if constexpr (opeDimC0 >= 4) { this->columns[3] = rParam.columns[3]; }\
+		if constexpr (opeDimC0 >= 1) { this->StoreColumn<0, true>(rParam.columns[0]); }\
+		if constexpr (opeDimC0 >= 2) { this->StoreColumn<1, true>(rParam.columns[1]); }\
+		if constexpr (opeDimC0 >= 3) { this->StoreColumn<2, true>(rParam.columns[2]); }\
+		if constexpr (opeDimC0 >= 4) { this->StoreColumn<3, true>(rParam.columns[3]); }\
 	}\
 \
 	/* コンストラクタ（4 次元）*/\
@@ -1590,16 +4054,16 @@ IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||);
 		opeDimR0, memDimR0,\
 		recursiveCount0\
 	>(\
-		const GenVec<Element0_t, opeDimR0> rParam0,\
-		const GenVec<Element0_t, opeDimR0> rParam1,\
-		const GenVec<Element0_t, opeDimR0> rParam2,\
-		const GenVec<Element0_t, opeDimR0> rParam3\
+		const TempColumn_t rParam0,\
+		const TempColumn_t rParam1,\
+		const TempColumn_t rParam2,\
+		const TempColumn_t rParam3\
 	){\
 		static_assert(opeDimC0 == 4);\
-		this->columns[0] = rParam0;\
-		this->columns[1] = rParam1;\
-		this->columns[2] = rParam2;\
-		this->columns[3] = rParam3;\
+		this->StoreColumn<0, true>(rParam0);\
+		this->StoreColumn<1, true>(rParam1);\
+		this->StoreColumn<2, true>(rParam2);\
+		this->StoreColumn<3, true>(rParam3);\
 	}\
 \
 	/* コンストラクタ（3 次元）*/\
@@ -1609,14 +4073,14 @@ IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||);
 		opeDimR0, memDimR0,\
 		recursiveCount0\
 	>(\
-		const GenVec<Element0_t, opeDimR0> rParam0,\
-		const GenVec<Element0_t, opeDimR0> rParam1,\
-		const GenVec<Element0_t, opeDimR0> rParam2\
+		const TempColumn_t rParam0,\
+		const TempColumn_t rParam1,\
+		const TempColumn_t rParam2\
 	){\
 		static_assert(opeDimC0 == 3);\
-		this->columns[0] = rParam0;\
-		this->columns[1] = rParam1;\
-		this->columns[2] = rParam2;\
+		this->StoreColumn<0, true>(rParam0);\
+		this->StoreColumn<1, true>(rParam1);\
+		this->StoreColumn<2, true>(rParam2);\
 	}\
 \
 	/* コンストラクタ（2 次元）*/\
@@ -1626,12 +4090,12 @@ IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||);
 		opeDimR0, memDimR0,\
 		recursiveCount0\
 	>(\
-		const GenVec<Element0_t, opeDimR0> rParam0,\
-		const GenVec<Element0_t, opeDimR0> rParam1\
+		const TempColumn_t rParam0,\
+		const TempColumn_t rParam1\
 	){\
 		static_assert(opeDimC0 == 2);\
-		this->columns[0] = rParam0;\
-		this->columns[1] = rParam1;\
+		this->StoreColumn<0, true>(rParam0);\
+		this->StoreColumn<1, true>(rParam1);\
 	}\
 \
 	/* コンストラクタ（1 次元）*/\
@@ -1641,10 +4105,10 @@ IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||);
 		opeDimR0, memDimR0,\
 		recursiveCount0\
 	>(\
-		const GenVec<Element0_t, opeDimR0> rParam0\
+		const TempColumn_t rParam0\
 	){\
 		static_assert(opeDimC0 == 1);\
-		this->columns[0] = rParam0;\
+		this->StoreColumn<0, true>(rParam0);\
 	}\
 \
 	/* デフォルトコンストラクタ */\
@@ -1668,34 +4132,47 @@ IMPL_VEC_NON_MEMBER_BINARY_OPERATOR(Bvec, ||);
 	}\
 
 /* 非メンバオペレータ */
-#define IMPL_MAT_NON_MEMBER_BINARY_OPERATOR(OP)\
+#define IMPL_MAT_NON_MEMBER_BINARY_OPERATOR(OP, simdFunc)\
 	/* スカラとの乗算：二項（第一引数がスカラの場合）*/\
 	template<typename Element_t, int opeDimC1, int memDimC1, int opeDimR1, int memDimR1, int recursiveCount1>\
-	static inline GenMat<Element_t, opeDimC1, opeDimR1>\
+	static inline GenMat2<Element_t, opeDimC1, opeDimR1, MatTraits<opeDimC1, memDimC1, opeDimR1, memDimR1, recursiveCount1>::tempMemDimR>\
 	operator OP(\
 		const Element_t param,\
 		const Mat<Element_t, opeDimC1, memDimC1, opeDimR1, memDimR1, recursiveCount1> &rThis\
 	){\
-		GenMat<Element_t, opeDimC1, opeDimR1> result;\
-		if constexpr (opeDimC1 >= 1) { result.elements[0] = param OP rThis.columns[0]; }\
-		if constexpr (opeDimC1 >= 2) { result.elements[1] = param OP rThis.columns[1]; }\
-		if constexpr (opeDimC1 >= 3) { result.elements[2] = param OP rThis.columns[2]; }\
-		if constexpr (opeDimC1 >= 4) { result.elements[3] = param OP rThis.columns[3]; }\
+		using MatTraits1_t = MatTraits<opeDimC1, memDimC1, opeDimR1, memDimR1, recursiveCount1>;\
+		GenMat2<Element_t, opeDimC1, opeDimR1, MatTraits1_t::tempMemDimR> result;\
+		if constexpr (\
+			(opeDimR1 == memDimR1 || MatTraits1_t::isPadded)\
+		&&	SimdPath<Element_t, Traits<opeDimR1, memDimR1, 0x3210>>::isEnabled\
+		) {\
+			using SimdVecTraits_t = GenSimdVecTraits<Element_t, memDimR1>;\
+			typename SimdVecTraits_t::IntrinsicType_t simdParam = SimdVecTraits_t::Set1(param);\
+			if constexpr (opeDimC1 >= 1) { result.columns[0].simdVec = SimdVecTraits_t::simdFunc(simdParam, rThis.columns[0].simdVec); }\
+			if constexpr (opeDimC1 >= 2) { result.columns[1].simdVec = SimdVecTraits_t::simdFunc(simdParam, rThis.columns[1].simdVec); }\
+			if constexpr (opeDimC1 >= 3) { result.columns[2].simdVec = SimdVecTraits_t::simdFunc(simdParam, rThis.columns[2].simdVec); }\
+			if constexpr (opeDimC1 >= 4) { result.columns[3].simdVec = SimdVecTraits_t::simdFunc(simdParam, rThis.columns[3].simdVec); }\
+			return result;\
+		}\
+		if constexpr (opeDimC1 >= 1) { result.columns[0] = param OP rThis.columns[0]; }\
+		if constexpr (opeDimC1 >= 2) { result.columns[1] = param OP rThis.columns[1]; }\
+		if constexpr (opeDimC1 >= 3) { result.columns[2] = param OP rThis.columns[2]; }\
+		if constexpr (opeDimC1 >= 4) { result.columns[3] = param OP rThis.columns[3]; }\
 		return result;\
 	}\
 \
 	/* スカラとの乗算：二項（第一引数が ScalarInVec の場合）*/\
 	template<typename Element_t, int memDim0, int index0, int opeDimC1, int memDimC1, int opeDimR1, int memDimR1, int recursiveCount1>\
-	static inline GenMat<Element_t, opeDimC1, opeDimR1>\
+	static inline GenMat2<Element_t, opeDimC1, opeDimR1, MatTraits<opeDimC1, memDimC1, opeDimR1, memDimR1, recursiveCount1>::tempMemDimR>\
 	operator OP(\
 		const ScalarInVec<Element_t, memDim0, index0> &rParam,\
 		const Mat<Element_t, opeDimC1, memDimC1, opeDimR1, memDimR1, recursiveCount1> &rThis\
 	){\
-		GenMat<Element_t, opeDimC1, opeDimR1> result;\
-		if constexpr (opeDimC1 >= 1) { result.elements[0] = rParam OP rThis.columns[0]; }\
-		if constexpr (opeDimC1 >= 2) { result.elements[1] = rParam OP rThis.columns[1]; }\
-		if constexpr (opeDimC1 >= 3) { result.elements[2] = rParam OP rThis.columns[2]; }\
-		if constexpr (opeDimC1 >= 4) { result.elements[3] = rParam OP rThis.columns[3]; }\
+		GenMat2<Element_t, opeDimC1, opeDimR1, MatTraits<opeDimC1, memDimC1, opeDimR1, memDimR1, recursiveCount1>::tempMemDimR> result;\
+		if constexpr (opeDimC1 >= 1) { result.columns[0] = rParam OP rThis.columns[0]; }\
+		if constexpr (opeDimC1 >= 2) { result.columns[1] = rParam OP rThis.columns[1]; }\
+		if constexpr (opeDimC1 >= 3) { result.columns[2] = rParam OP rThis.columns[2]; }\
+		if constexpr (opeDimC1 >= 4) { result.columns[3] = rParam OP rThis.columns[3]; }\
 		return result;\
 	}\
 
@@ -1731,7 +4208,7 @@ template<
 	int opeDimR0, int memDimR0,
 	int recursiveCount0
 >
-union Mat {
+union GLSLMATH_MAY_ALIAS Mat {
 	/* 共通部分 */
 	IMPL_MAT_COMMON(Mat);
 
@@ -1742,23 +4219,23 @@ union Mat {
 	IMPL_MAT_ARRAY_SUBSCRIPT_OPERATOR();
 
 	/* 単項演算 */
-	IMPL_MAT_UNARY_OPERATOR(+);
-	IMPL_MAT_UNARY_OPERATOR(-);
+	IMPL_MAT_UNARY_OPERATOR(+, Pos);
+	IMPL_MAT_UNARY_OPERATOR(-, Neg);
 
 	/* 二項演算 */
-	IMPL_MAT_BINARY_OPERATOR(+);
-	IMPL_MAT_BINARY_OPERATOR(-);
-	IMPL_MAT_BINARY_OPERATOR_WITH_SCALAR(+);
-	IMPL_MAT_BINARY_OPERATOR_WITH_SCALAR(-);
-	IMPL_MAT_BINARY_OPERATOR_WITH_SCALAR(*);
+	IMPL_MAT_BINARY_OPERATOR(+, Add);
+	IMPL_MAT_BINARY_OPERATOR(-, Sub);
+	IMPL_MAT_BINARY_OPERATOR_WITH_SCALAR(+, Add);
+	IMPL_MAT_BINARY_OPERATOR_WITH_SCALAR(-, Sub);
+	IMPL_MAT_BINARY_OPERATOR_WITH_SCALAR(*, Mul);
 	IMPL_MAT_BINARY_OPERATOR_WITH_SCALAR_DIV_FAST_PATH();
 
 	/* 二項演算と代入 */
-	IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR(+);
-	IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR(-);
-	IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(+);
-	IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(-);
-	IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(*);
+	IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR(+, Add);
+	IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR(-, Sub);
+	IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(+, Add);
+	IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(-, Sub);
+	IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(*, Mul);
 	IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR_DIV_FAST_PATH();
 
 	/* 行列とベクトルの演算 */
@@ -1799,7 +4276,7 @@ template<
 	int opeDimC0, int memDimC0,
 	int opeDimR0, int memDimR0
 >
-union Mat<Element0_t, opeDimC0, memDimC0, opeDimR0, memDimR0, 1>{
+union GLSLMATH_MAY_ALIAS Mat<Element0_t, opeDimC0, memDimC0, opeDimR0, memDimR0, 1>{
 	enum { recursiveCount0 = 1 };
 
 	/* 共通部分 */
@@ -1809,23 +4286,23 @@ union Mat<Element0_t, opeDimC0, memDimC0, opeDimR0, memDimR0, 1>{
 	IMPL_MAT_ARRAY_SUBSCRIPT_OPERATOR();
 
 	/* 単項演算 */
-	IMPL_MAT_UNARY_OPERATOR(+);
-	IMPL_MAT_UNARY_OPERATOR(-);
+	IMPL_MAT_UNARY_OPERATOR(+, Pos);
+	IMPL_MAT_UNARY_OPERATOR(-, Neg);
 
 	/* 二項演算 */
-	IMPL_MAT_BINARY_OPERATOR(+);
-	IMPL_MAT_BINARY_OPERATOR(-);
-	IMPL_MAT_BINARY_OPERATOR_WITH_SCALAR(+);
-	IMPL_MAT_BINARY_OPERATOR_WITH_SCALAR(-);
-	IMPL_MAT_BINARY_OPERATOR_WITH_SCALAR(*);
+	IMPL_MAT_BINARY_OPERATOR(+, Add);
+	IMPL_MAT_BINARY_OPERATOR(-, Sub);
+	IMPL_MAT_BINARY_OPERATOR_WITH_SCALAR(+, Add);
+	IMPL_MAT_BINARY_OPERATOR_WITH_SCALAR(-, Sub);
+	IMPL_MAT_BINARY_OPERATOR_WITH_SCALAR(*, Mul);
 	IMPL_MAT_BINARY_OPERATOR_WITH_SCALAR_DIV_FAST_PATH();
 
 	/* 二項演算と代入 */
-	IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR(+);
-	IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR(-);
-	IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(+);
-	IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(-);
-	IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(*);
+	IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR(+, Add);
+	IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR(-, Sub);
+	IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(+, Add);
+	IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(-, Sub);
+	IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR(*, Mul);
 	IMPL_MAT_COMPOUND_ASSIGNMENT_OPERATOR_WITH_SCALAR_DIV_FAST_PATH();
 
 	/* 行列とベクトルの演算 */
@@ -1851,10 +4328,10 @@ union Mat<Element0_t, opeDimC0, memDimC0, opeDimR0, memDimR0, 1>{
 };
 
 /* 非メンバオペレータ */
-IMPL_MAT_NON_MEMBER_BINARY_OPERATOR(+);
-IMPL_MAT_NON_MEMBER_BINARY_OPERATOR(-);
-IMPL_MAT_NON_MEMBER_BINARY_OPERATOR(*);
-IMPL_MAT_NON_MEMBER_BINARY_OPERATOR(/);
+IMPL_MAT_NON_MEMBER_BINARY_OPERATOR(+, Add);
+IMPL_MAT_NON_MEMBER_BINARY_OPERATOR(-, Sub);
+IMPL_MAT_NON_MEMBER_BINARY_OPERATOR(*, Mul);
+IMPL_MAT_NON_MEMBER_BINARY_OPERATOR(/, Div);
 
 /* address-of 演算子 */
 IMPL_MAT_NON_MEMBER_ADDRESS_OF_OPERATOR();
@@ -1863,9 +4340,30 @@ IMPL_MAT_NON_MEMBER_ADDRESS_OF_OPERATOR();
 /*=============================================================================
 ▼	Bvec 対応比較関数
 -----------------------------------------------------------------------------*/
-#define IMPL_NON_MEMBER_COMPARISON_FUNCTION(funcName, OP)\
+/*
+	比較関数の戻り値の型
+	32 bit 成分 4 つを SIMD レジスタ上で比較できる場合は、レーンマスク形式の Bvec を返す。
+*/
+template<typename Element_t, typename Traits0_t, typename Traits1_t>
+struct ComparisonResult {
+	enum {
+		isLaneMask =
+			sizeof(Element_t) == 4
+		&&	Traits0_t::memDim == 4
+		&&	Traits1_t::memDim == 4
+		&&	SimdPath<Element_t, Traits0_t>::isReadable
+		&&	SimdPath<Element_t, Traits1_t>::isReadable
+	};
+	using Type_t = std::conditional_t<
+		isLaneMask,
+		GenBvec2<LaneBool, Traits0_t::opeDim, Traits0_t::tempMemDim>,
+		GenBvec<bool, Traits0_t::opeDim>
+	>;
+};
+
+#define IMPL_NON_MEMBER_COMPARISON_FUNCTION(funcName, OP, simdFunc)\
 template<typename Element_t, int opeDim, int memDim0, int memDim1, int swizzle0, int swizzle1, int recursiveCount0, int recursiveCount1>\
-static inline GenBvec<bool, opeDim> funcName(\
+static inline typename ComparisonResult<Element_t, Traits<opeDim, memDim0, swizzle0>, Traits<opeDim, memDim1, swizzle1>>::Type_t funcName(\
 	const Vec<Element_t, Traits<opeDim, memDim0, swizzle0>, recursiveCount0> &rParam0,\
 	const Vec<Element_t, Traits<opeDim, memDim1, swizzle1>, recursiveCount1> &rParam1\
 ){\
@@ -1873,7 +4371,22 @@ static inline GenBvec<bool, opeDim> funcName(\
 	using Traits1_t = Traits<opeDim, memDim1, swizzle1>;\
 	static_assert(Traits0_t::isValid);\
 	static_assert(Traits1_t::isValid);\
-	GenBvec<bool, opeDim> result;\
+	using Result_t = ComparisonResult<Element_t, Traits0_t, Traits1_t>;\
+	typename Result_t::Type_t result;\
+	if constexpr (Result_t::isLaneMask) {\
+		/* 比較結果のマスクをそのまま返す */\
+		using SimdVecTraits_t = GenSimdVecTraits<Element_t, memDim0>;\
+		result.simdVec = GenSimdVecTraits<LaneBool, 4>::FromMask(SimdVecTraits_t::simdFunc(rParam0.GetSimdVec(), rParam1.GetSimdVec()));\
+		return result;\
+	} else if constexpr (memDim0 == memDim1 && SimdPath<Element_t, Traits0_t>::isReadable && SimdPath<Element_t, Traits1_t>::isReadable) {\
+		using SimdVecTraits_t = GenSimdVecTraits<Element_t, memDim0>;\
+		int bits = SimdVecTraits_t::MoveMask(SimdVecTraits_t::simdFunc(rParam0.GetSimdVec(), rParam1.GetSimdVec()));\
+		if constexpr (opeDim >= 1) { result.elements[0] = (bits & 1) != 0; }\
+		if constexpr (opeDim >= 2) { result.elements[1] = (bits & 2) != 0; }\
+		if constexpr (opeDim >= 3) { result.elements[2] = (bits & 4) != 0; }\
+		if constexpr (opeDim >= 4) { result.elements[3] = (bits & 8) != 0; }\
+		return result;\
+	}\
 	if constexpr (opeDim >= 1) { result.elements[0] = (rParam0.elements[Traits0_t::i0] OP rParam1.elements[Traits1_t::i0]); }\
 	if constexpr (opeDim >= 2) { result.elements[1] = (rParam0.elements[Traits0_t::i1] OP rParam1.elements[Traits1_t::i1]); }\
 	if constexpr (opeDim >= 3) { result.elements[2] = (rParam0.elements[Traits0_t::i2] OP rParam1.elements[Traits1_t::i2]); }\
@@ -1882,7 +4395,7 @@ static inline GenBvec<bool, opeDim> funcName(\
 }\
 \
 template<typename Element_t, int opeDim, int memDim0, int memDim1, int swizzle0, int swizzle1, int recursiveCount0, int recursiveCount1>\
-static inline GenBvec<bool, opeDim> funcName(\
+static inline typename ComparisonResult<Element_t, Traits<opeDim, memDim0, swizzle0>, Traits<opeDim, memDim1, swizzle1>>::Type_t funcName(\
 	const Ivec<Element_t, Traits<opeDim, memDim0, swizzle0>, recursiveCount0> &rParam0,\
 	const Ivec<Element_t, Traits<opeDim, memDim1, swizzle1>, recursiveCount1> &rParam1\
 ){\
@@ -1890,7 +4403,22 @@ static inline GenBvec<bool, opeDim> funcName(\
 	using Traits1_t = Traits<opeDim, memDim1, swizzle1>;\
 	static_assert(Traits0_t::isValid);\
 	static_assert(Traits1_t::isValid);\
-	GenBvec<bool, opeDim> result;\
+	using Result_t = ComparisonResult<Element_t, Traits0_t, Traits1_t>;\
+	typename Result_t::Type_t result;\
+	if constexpr (Result_t::isLaneMask) {\
+		/* 比較結果のマスクをそのまま返す */\
+		using SimdVecTraits_t = GenSimdVecTraits<Element_t, memDim0>;\
+		result.simdVec = GenSimdVecTraits<LaneBool, 4>::FromMask(SimdVecTraits_t::simdFunc(rParam0.GetSimdVec(), rParam1.GetSimdVec()));\
+		return result;\
+	} else if constexpr (memDim0 == memDim1 && SimdPath<Element_t, Traits0_t>::isReadable && SimdPath<Element_t, Traits1_t>::isReadable) {\
+		using SimdVecTraits_t = GenSimdVecTraits<Element_t, memDim0>;\
+		int bits = SimdVecTraits_t::MoveMask(SimdVecTraits_t::simdFunc(rParam0.GetSimdVec(), rParam1.GetSimdVec()));\
+		if constexpr (opeDim >= 1) { result.elements[0] = (bits & 1) != 0; }\
+		if constexpr (opeDim >= 2) { result.elements[1] = (bits & 2) != 0; }\
+		if constexpr (opeDim >= 3) { result.elements[2] = (bits & 4) != 0; }\
+		if constexpr (opeDim >= 4) { result.elements[3] = (bits & 8) != 0; }\
+		return result;\
+	}\
 	if constexpr (opeDim >= 1) { result.elements[0] = (rParam0.elements[Traits0_t::i0] OP rParam1.elements[Traits1_t::i0]); }\
 	if constexpr (opeDim >= 2) { result.elements[1] = (rParam0.elements[Traits0_t::i1] OP rParam1.elements[Traits1_t::i1]); }\
 	if constexpr (opeDim >= 3) { result.elements[2] = (rParam0.elements[Traits0_t::i2] OP rParam1.elements[Traits1_t::i2]); }\
@@ -1898,18 +4426,22 @@ static inline GenBvec<bool, opeDim> funcName(\
 	return result;\
 }\
 
-IMPL_NON_MEMBER_COMPARISON_FUNCTION(lessThan, <);
-IMPL_NON_MEMBER_COMPARISON_FUNCTION(lessThanEqual, <=);
-IMPL_NON_MEMBER_COMPARISON_FUNCTION(greaterThan, >);
-IMPL_NON_MEMBER_COMPARISON_FUNCTION(greaterThanEqual, >=);
-IMPL_NON_MEMBER_COMPARISON_FUNCTION(equal, ==);
-IMPL_NON_MEMBER_COMPARISON_FUNCTION(notEqual, !=);
+IMPL_NON_MEMBER_COMPARISON_FUNCTION(lessThan, <, CmpLt);
+IMPL_NON_MEMBER_COMPARISON_FUNCTION(lessThanEqual, <=, CmpLe);
+IMPL_NON_MEMBER_COMPARISON_FUNCTION(greaterThan, >, CmpGt);
+IMPL_NON_MEMBER_COMPARISON_FUNCTION(greaterThanEqual, >=, CmpGe);
+IMPL_NON_MEMBER_COMPARISON_FUNCTION(equal, ==, CmpEq);
+IMPL_NON_MEMBER_COMPARISON_FUNCTION(notEqual, !=, CmpNe);
 
 template<typename Element0_t, typename Traits0_t, int recursiveCount0>
 static inline bool any(
 	const Bvec<Element0_t, Traits0_t, recursiveCount0> &rParam
 ){
 	static_assert(Traits0_t::isValid);
+	if constexpr (SimdPath<Element0_t, Traits0_t>::isReadable) {
+		int bits = GenSimdVecTraits<Element0_t, Traits0_t::memDim>::MoveMask(rParam.GetSimdVec());
+		return (bits & ((1 << Traits0_t::opeDim) - 1)) != 0;
+	}
 	if constexpr (Traits0_t::opeDim >= 1) { if (rParam.elements[Traits0_t::i0]) return true; }
 	if constexpr (Traits0_t::opeDim >= 2) { if (rParam.elements[Traits0_t::i1]) return true; }
 	if constexpr (Traits0_t::opeDim >= 3) { if (rParam.elements[Traits0_t::i2]) return true; }
@@ -1922,6 +4454,10 @@ static inline bool all(
 	const Bvec<Element0_t, Traits0_t, recursiveCount0> &rParam
 ){
 	static_assert(Traits0_t::isValid);
+	if constexpr (SimdPath<Element0_t, Traits0_t>::isReadable) {
+		int bits = GenSimdVecTraits<Element0_t, Traits0_t::memDim>::MoveMask(rParam.GetSimdVec());
+		return (bits & ((1 << Traits0_t::opeDim) - 1)) == ((1 << Traits0_t::opeDim) - 1);
+	}
 	if constexpr (Traits0_t::opeDim >= 1) { if (rParam.elements[Traits0_t::i0] == false) return false; }
 	if constexpr (Traits0_t::opeDim >= 2) { if (rParam.elements[Traits0_t::i1] == false) return false; }
 	if constexpr (Traits0_t::opeDim >= 3) { if (rParam.elements[Traits0_t::i2] == false) return false; }
@@ -1963,6 +4499,17 @@ static inline double degrees(double radians){
 using ::std::sin;
 using ::std::cos;
 using ::std::tan;
+
+/* sin と cos を同時に求める（GLSL には無い拡張）*/
+static inline void sincos(float x, float &rSin, float &rCos){
+	rSin = std::sin(x);
+	rCos = std::cos(x);
+}
+static inline void sincos(double x, double &rSin, double &rCos){
+	rSin = std::sin(x);
+	rCos = std::cos(x);
+}
+
 using ::std::asin;
 using ::std::acos;
 using ::std::atan;
@@ -1982,6 +4529,17 @@ using ::std::acosh;
 using ::std::atanh;
 
 using ::std::pow;
+
+/* 指数がコンパイル時定数 numerator / denominator の pow */
+template<int numerator, int denominator = 1>
+static inline float pow(float x){
+	return GenSimdVecTraits<float, 4>::ExtractFirst(GenSimdVecTraits<float, 4>::PowConst<numerator, denominator>(_mm_set1_ps(x)));
+}
+template<int numerator, int denominator = 1>
+static inline double pow(double x){
+	return GenSimdVecTraits<double, 2>::ExtractFirst(GenSimdVecTraits<double, 2>::PowConst<numerator, denominator>(_mm_set1_pd(x)));
+}
+
 using ::std::exp;
 using ::std::log;
 using ::std::exp2;
@@ -1990,7 +4548,11 @@ using ::std::log2;
 using ::std::sqrt;
 
 static inline float invertsqrt(float x){
+#if GLSLMATH_PRECISE_INVERTSQRT
 	return std::sqrt(1.0f / x);
+#else
+	return GenSimdVecTraits<float, 4>::ExtractFirst(GenSimdVecTraits<float, 4>::InvertSqrt(_mm_set1_ps(x)));
+#endif
 }
 static inline double invertsqrt(double x){
 	return std::sqrt(1.0 / x);
@@ -2003,6 +4565,9 @@ static inline int sign(int x){
 	if (x > 0) return 1;
 	return 0;
 }
+static inline unsigned int sign(unsigned int x){
+	return (x > 0)? 1u : 0u;
+}
 static inline float sign(float x){
 	if (x < 0) return -1.0f;
 	if (x > 0) return 1.0f;
@@ -2019,40 +4584,43 @@ using ::std::trunc;
 using ::std::round;
 
 static inline float roundEven(float x){
+	/* 結果が 0 になる場合も x の符号を保つ */
 	float i = std::floor(x);
-	x -= i;
-	if (x < 0.5f) return i;
-	if (x > 0.5f) return i + 1.0f;
+	float f = x - i;
+	if (f < 0.5f) return std::copysign(i, x);
+	if (f > 0.5f) return std::copysign(i + 1.0f, x);
 	float intPart;
 	(void)std::modf(i / 2.0f, &intPart);
-	if ((2.0f * intPart) == i) return i;
-	return i + 1.0f;
+	if ((2.0f * intPart) == i) return std::copysign(i, x);
+	return std::copysign(i + 1.0f, x);
 }
 static inline double roundEven(double x){
+	/* 結果が 0 になる場合も x の符号を保つ */
 	double i = std::floor(x);
-	x -= i;
-	if (x < 0.5) return i;
-	if (x > 0.5) return i + 1.0;
+	double f = x - i;
+	if (f < 0.5) return std::copysign(i, x);
+	if (f > 0.5) return std::copysign(i + 1.0, x);
 	double intPart;
 	(void)std::modf(i / 2.0, &intPart);
-	if ((2.0 * intPart) == i) return i;
-	return i + 1.0;
+	if ((2.0 * intPart) == i) return std::copysign(i, x);
+	return std::copysign(i + 1.0, x);
 }
 
 using ::std::ceil;
 
 static inline float fract(float x){
-	return 1.0f - std::floor(x);
+	return x - std::floor(x);
 }
 static inline double fract(double x){
-	return 1.0 - std::floor(x);
+	return x - std::floor(x);
 }
 
+/* GLSL の mod は x - y * floor(x / y) であり、std::fmod とは負数の扱いが異なる。*/
 static inline float mod(float x, float y){
-	return std::fmod(x, y);
+	return x - y * std::floor(x / y);
 }
 static inline double mod(double x, double y){
-	return std::fmod(x, y);
+	return x - y * std::floor(x / y);
 }
 
 /* 標準の modf は、第二引数はポインタだが、GLSL の仕様では参照になる。*/
@@ -2074,6 +4642,12 @@ static inline double modf(double x, ScalarInVec<double, memDim0, index0> &y){
 #if 0
 using ::std::min;			/* @@ なぜかうまくいかない */
 #else
+static inline int min(int x, int y){
+	return x < y ? x : y;
+}
+static inline unsigned int min(unsigned int x, unsigned int y){
+	return x < y ? x : y;
+}
 static inline float min(float x, float y){
 	return x < y ? x : y;
 }
@@ -2085,6 +4659,12 @@ static inline double min(double x, double y){
 #if 0
 using ::std::max;			/* @@ なぜかうまくいかない */
 #else
+static inline int max(int x, int y){
+	return x > y ? x : y;
+}
+static inline unsigned int max(unsigned int x, unsigned int y){
+	return x > y ? x : y;
+}
 static inline float max(float x, float y){
 	return x > y ? x : y;
 }
@@ -2094,13 +4674,16 @@ static inline double max(double x, double y){
 #endif
 
 static inline int clamp(int x, int minVal, int maxVal){
-	return std::max(std::min(x, minVal), maxVal);
+	return std::min(std::max(x, minVal), maxVal);
+}
+static inline unsigned int clamp(unsigned int x, unsigned int minVal, unsigned int maxVal){
+	return std::min(std::max(x, minVal), maxVal);
 }
 static inline float clamp(float x, float minVal, float maxVal){
-	return std::max(std::min(x, minVal), maxVal);
+	return min(max(x, minVal), maxVal);
 }
 static inline double clamp(double x, double minVal, double maxVal){
-	return std::max(std::min(x, minVal), maxVal);
+	return min(max(x, minVal), maxVal);
 }
 
 static inline float mix(float x, float y, float a){
@@ -2111,6 +4694,12 @@ static inline double mix(double x, double y, double a){
 //	return std::lerp(x, y, a);		/* C++20 */
 	return x + (y - x) * a;
 }
+static inline float mix(float x, float y, bool a){
+	return a? y : x;
+}
+static inline double mix(double x, double y, bool a){
+	return a? y : x;
+}
 
 static inline float step(float edge, float x){
 	return (x < edge)? 0.0f : 1.0f;
@@ -2267,12 +4856,185 @@ funcName(\
 }\
 
 
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, radians, radians);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, degrees, degrees);
+/*
+	以下の _SIMD 版は、全引数が SIMD 演算可能な場合に SimdVecTraits_t::simdFunc を用いる。
+	それ以外の場合は subFunc を成分ごとに呼び出す。
+*/
+/* 引数が 1 個の要素ごとの関数呼び出し（SIMD 版）*/
+#define IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS_SIMD(InputType_t, OutputType_t, funcName, subFunc, simdFunc)\
+template<typename Element_t, typename Traits_t, int recursiveCount>\
+static inline Gen##OutputType_t##2<Element_t, Traits_t::opeDim, Traits_t::tempMemDim> funcName(\
+	const InputType_t<Element_t, Traits_t, recursiveCount> &rParam\
+){\
+	static_assert(Traits_t::isValid);\
+	Gen##OutputType_t##2<Element_t, Traits_t::opeDim, Traits_t::tempMemDim> result;\
+	if constexpr (SimdPath<Element_t, Traits_t>::isReadable) {\
+		using SimdVecTraits_t = GenSimdVecTraits<Element_t, Traits_t::memDim>;\
+		result.simdVec = SimdPath<Element_t, Traits_t>::ClearPadding(\
+			SimdVecTraits_t::simdFunc(SimdPath<Element_t, Traits_t>::template PadOperand<1>(rParam.GetSimdVec()))\
+		);\
+		return result;\
+	}\
+	if constexpr (Traits_t::opeDim >= 1) { result.elements[0] = subFunc(rParam.elements[Traits_t::i0]); }\
+	if constexpr (Traits_t::opeDim >= 2) { result.elements[1] = subFunc(rParam.elements[Traits_t::i1]); }\
+	if constexpr (Traits_t::opeDim >= 3) { result.elements[2] = subFunc(rParam.elements[Traits_t::i2]); }\
+	if constexpr (Traits_t::opeDim >= 4) { result.elements[3] = subFunc(rParam.elements[Traits_t::i3]); }\
+	return result;\
+}\
+
+/* 引数が 2 個の要素ごとの関数呼び出し（SIMD 版）*/
+#define IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_2ARGS_SIMD(InputType_t, OutputType_t, funcName, subFunc, simdFunc)\
+template<typename Element_t, int opeDim, int memDim0, int memDim1, int swizzle0, int swizzle1, int recursiveCount0, int recursiveCount1>\
+static inline Gen##OutputType_t##2<Element_t, opeDim, Traits<opeDim, memDim0, swizzle0>::tempMemDim>\
+funcName(\
+	const InputType_t<Element_t, Traits<opeDim, memDim0, swizzle0>, recursiveCount0> &rParam0,\
+	const InputType_t<Element_t, Traits<opeDim, memDim1, swizzle1>, recursiveCount1> &rParam1\
+){\
+	using Traits0_t = Traits<opeDim, memDim0, swizzle0>;\
+	using Traits1_t = Traits<opeDim, memDim1, swizzle1>;\
+	static_assert(Traits0_t::isValid);\
+	static_assert(Traits1_t::isValid);\
+	Gen##OutputType_t##2<Element_t, opeDim, Traits0_t::tempMemDim> result;\
+	if constexpr (\
+		memDim0 == memDim1\
+	&&	SimdPath<Element_t, Traits0_t>::isReadable\
+	&&	SimdPath<Element_t, Traits1_t>::isReadable\
+	) {\
+		using SimdVecTraits_t = GenSimdVecTraits<Element_t, memDim0>;\
+		result.simdVec = SimdPath<Element_t, Traits0_t>::ClearPadding(SimdVecTraits_t::simdFunc(\
+			rParam0.GetSimdVec(), SimdPath<Element_t, Traits1_t>::template PadOperand<1>(rParam1.GetSimdVec())\
+		));\
+		return result;\
+	}\
+	if constexpr (opeDim >= 1) { result.elements[0] = subFunc(rParam0.elements[Traits0_t::i0], rParam1.elements[Traits1_t::i0]); }\
+	if constexpr (opeDim >= 2) { result.elements[1] = subFunc(rParam0.elements[Traits0_t::i1], rParam1.elements[Traits1_t::i1]); }\
+	if constexpr (opeDim >= 3) { result.elements[2] = subFunc(rParam0.elements[Traits0_t::i2], rParam1.elements[Traits1_t::i2]); }\
+	if constexpr (opeDim >= 4) { result.elements[3] = subFunc(rParam0.elements[Traits0_t::i3], rParam1.elements[Traits1_t::i3]); }\
+	return result;\
+}\
+
+/* 引数が 3 個の要素ごとの関数呼び出し（SIMD 版）*/
+#define IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_3ARGS_SIMD(InputType_t, OutputType_t, funcName, subFunc, simdFunc)\
+template<typename Element_t, int opeDim, int memDim0, int memDim1, int memDim2, int swizzle0, int swizzle1, int swizzle2, int recursiveCount0, int recursiveCount1, int recursiveCount2>\
+static inline Gen##OutputType_t##2<Element_t, opeDim, Traits<opeDim, memDim0, swizzle0>::tempMemDim>\
+funcName(\
+	const InputType_t<Element_t, Traits<opeDim, memDim0, swizzle0>, recursiveCount0> &rParam0,\
+	const InputType_t<Element_t, Traits<opeDim, memDim1, swizzle1>, recursiveCount1> &rParam1,\
+	const InputType_t<Element_t, Traits<opeDim, memDim2, swizzle2>, recursiveCount2> &rParam2\
+){\
+	using Traits0_t = Traits<opeDim, memDim0, swizzle0>;\
+	using Traits1_t = Traits<opeDim, memDim1, swizzle1>;\
+	using Traits2_t = Traits<opeDim, memDim2, swizzle2>;\
+	static_assert(Traits0_t::isValid);\
+	static_assert(Traits1_t::isValid);\
+	static_assert(Traits2_t::isValid);\
+	Gen##OutputType_t##2<Element_t, opeDim, Traits0_t::tempMemDim> result;\
+	if constexpr (\
+		memDim0 == memDim1\
+	&&	SimdPath<Element_t, Traits0_t>::isReadable\
+	&&	SimdPath<Element_t, Traits1_t>::isReadable\
+	&&	memDim0 == memDim2\
+	&&	SimdPath<Element_t, Traits2_t>::isReadable\
+	) {\
+		using SimdVecTraits_t = GenSimdVecTraits<Element_t, memDim0>;\
+		result.simdVec = SimdPath<Element_t, Traits0_t>::ClearPadding(SimdVecTraits_t::simdFunc(\
+			rParam0.GetSimdVec(),\
+			SimdPath<Element_t, Traits1_t>::template PadOperand<1>(rParam1.GetSimdVec()),\
+			SimdPath<Element_t, Traits2_t>::template PadOperand<1>(rParam2.GetSimdVec())\
+		));\
+		return result;\
+	}\
+	if constexpr (opeDim >= 1) { result.elements[0] = subFunc(rParam0.elements[Traits0_t::i0], rParam1.elements[Traits1_t::i0], rParam2.elements[Traits2_t::i0]); }\
+	if constexpr (opeDim >= 2) { result.elements[1] = subFunc(rParam0.elements[Traits0_t::i1], rParam1.elements[Traits1_t::i1], rParam2.elements[Traits2_t::i1]); }\
+	if constexpr (opeDim >= 3) { result.elements[2] = subFunc(rParam0.elements[Traits0_t::i2], rParam1.elements[Traits1_t::i2], rParam2.elements[Traits2_t::i2]); }\
+	if constexpr (opeDim >= 4) { result.elements[3] = subFunc(rParam0.elements[Traits0_t::i3], rParam1.elements[Traits1_t::i3], rParam2.elements[Traits2_t::i3]); }\
+	return result;\
+}\
+
+/*
+	引数が 1 個の要素ごとの関数呼び出し（4 成分 SIMD 版）
+	SIMD 演算できない型（vec2 vec3 など）も 4 成分の SIMD 型に詰め替えて SimdVecTraits_t::simdFunc を用いる。
+	成分ごとの subFunc 呼び出しが詰め替えより重い関数に用いる。
+	simdFunc には演算次元をテンプレート引数として渡す（演算次元を超える成分の値で分岐しないようにするため）。
+	GLSLMATH_USE_SIMD_TRANSCENDENTAL が 0 の場合は、成分ごとに subFunc を呼ぶ。
+*/
+#define IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS_SIMD4(InputType_t, OutputType_t, funcName, subFunc, simdFunc)\
+template<typename Element_t, typename Traits_t, int recursiveCount>\
+static inline Gen##OutputType_t##2<Element_t, Traits_t::opeDim, Traits_t::tempMemDim> funcName(\
+	const InputType_t<Element_t, Traits_t, recursiveCount> &rParam\
+){\
+	static_assert(Traits_t::isValid);\
+	Gen##OutputType_t##2<Element_t, Traits_t::opeDim, Traits_t::tempMemDim> result;\
+	if constexpr (GLSLMATH_USE_SIMD_TRANSCENDENTAL && SimdPath<Element_t, Traits_t>::isReadable) {\
+		using SimdVecTraits_t = GenSimdVecTraits<Element_t, Traits_t::memDim>;\
+		result.simdVec = SimdPath<Element_t, Traits_t>::ClearPadding(SimdVecTraits_t::template simdFunc<Traits_t::opeDim>(\
+			SimdPath<Element_t, Traits_t>::template PadOperand<1>(rParam.GetSimdVec())\
+		));\
+	} else if constexpr (GLSLMATH_USE_SIMD_TRANSCENDENTAL && GenSimdVecTraits<Element_t, 4>::isSimd) {\
+		using SimdVecTraits_t = GenSimdVecTraits<Element_t, 4>;\
+		SimdVecTraits_t::template StorePartial<Traits_t::opeDim>(\
+			result.elements, SimdVecTraits_t::template simdFunc<Traits_t::opeDim>(SimdPath<Element_t, Traits_t>::LoadWidened(rParam.elements))\
+		);\
+	} else {\
+		if constexpr (Traits_t::opeDim >= 1) { result.elements[0] = subFunc(rParam.elements[Traits_t::i0]); }\
+		if constexpr (Traits_t::opeDim >= 2) { result.elements[1] = subFunc(rParam.elements[Traits_t::i1]); }\
+		if constexpr (Traits_t::opeDim >= 3) { result.elements[2] = subFunc(rParam.elements[Traits_t::i2]); }\
+		if constexpr (Traits_t::opeDim >= 4) { result.elements[3] = subFunc(rParam.elements[Traits_t::i3]); }\
+		result.ClearPadding();\
+	}\
+	return result;\
+}\
+
+/* 引数が 2 個の要素ごとの関数呼び出し（4 成分 SIMD 版。テンプレート引数と GLSLMATH_USE_SIMD_TRANSCENDENTAL の扱いは 1 引数版と同じ）*/
+#define IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_2ARGS_SIMD4(InputType_t, OutputType_t, funcName, subFunc, simdFunc)\
+template<typename Element_t, int opeDim, int memDim0, int memDim1, int swizzle0, int swizzle1, int recursiveCount0, int recursiveCount1>\
+static inline Gen##OutputType_t##2<Element_t, opeDim, Traits<opeDim, memDim0, swizzle0>::tempMemDim>\
+funcName(\
+	const InputType_t<Element_t, Traits<opeDim, memDim0, swizzle0>, recursiveCount0> &rParam0,\
+	const InputType_t<Element_t, Traits<opeDim, memDim1, swizzle1>, recursiveCount1> &rParam1\
+){\
+	using Traits0_t = Traits<opeDim, memDim0, swizzle0>;\
+	using Traits1_t = Traits<opeDim, memDim1, swizzle1>;\
+	static_assert(Traits0_t::isValid);\
+	static_assert(Traits1_t::isValid);\
+	Gen##OutputType_t##2<Element_t, opeDim, Traits0_t::tempMemDim> result;\
+	if constexpr (\
+		GLSLMATH_USE_SIMD_TRANSCENDENTAL\
+	&&	memDim0 == memDim1\
+	&&	SimdPath<Element_t, Traits0_t>::isReadable\
+	&&	SimdPath<Element_t, Traits1_t>::isReadable\
+	) {\
+		using SimdVecTraits_t = GenSimdVecTraits<Element_t, memDim0>;\
+		result.simdVec = SimdPath<Element_t, Traits0_t>::ClearPadding(SimdVecTraits_t::template simdFunc<opeDim>(\
+			SimdPath<Element_t, Traits0_t>::template PadOperand<1>(rParam0.GetSimdVec()),\
+			SimdPath<Element_t, Traits1_t>::template PadOperand<1>(rParam1.GetSimdVec())\
+		));\
+	} else if constexpr (GLSLMATH_USE_SIMD_TRANSCENDENTAL && GenSimdVecTraits<Element_t, 4>::isSimd) {\
+		using SimdVecTraits_t = GenSimdVecTraits<Element_t, 4>;\
+		SimdVecTraits_t::template StorePartial<opeDim>(\
+			result.elements,\
+			SimdVecTraits_t::template simdFunc<opeDim>(\
+				SimdPath<Element_t, Traits0_t>::LoadWidened(rParam0.elements),\
+				SimdPath<Element_t, Traits1_t>::LoadWidened(rParam1.elements)\
+			)\
+		);\
+	} else {\
+		if constexpr (opeDim >= 1) { result.elements[0] = subFunc(rParam0.elements[Traits0_t::i0], rParam1.elements[Traits1_t::i0]); }\
+		if constexpr (opeDim >= 2) { result.elements[1] = subFunc(rParam0.elements[Traits0_t::i1], rParam1.elements[Traits1_t::i1]); }\
+		if constexpr (opeDim >= 3) { result.elements[2] = subFunc(rParam0.elements[Traits0_t::i2], rParam1.elements[Traits1_t::i2]); }\
+		if constexpr (opeDim >= 4) { result.elements[3] = subFunc(rParam0.elements[Traits0_t::i3], rParam1.elements[Traits1_t::i3]); }\
+		result.ClearPadding();\
+	}\
+	return result;\
+}\
+
+
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS_SIMD(Vec, Vec, radians, radians, Radians);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS_SIMD(Vec, Vec, degrees, degrees, Degrees);
 
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, sin, sin);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, cos, cos);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, tan, tan);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS_SIMD4(Vec, Vec, sin, sin, Sin);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS_SIMD4(Vec, Vec, cos, cos, Cos);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS_SIMD4(Vec, Vec, tan, tan, Tan);
 IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, asin, asin);
 IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, acos, acos);
 IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, atan, atan);
@@ -2284,37 +5046,130 @@ IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, asinh, asinh);
 IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, acosh, acosh);
 IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, atanh, atanh);
 
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_2ARGS(Vec, Vec, pow, pow);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, exp, exp);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, log, log);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, exp2, exp2);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, log2, log2);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, sqrt, sqrt);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, invertsqrt, invertsqrt);
-
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, abs, abs);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Ivec, Ivec, abs, abs);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, sign, sign);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Ivec, Ivec, sign, sign);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, floor, floor);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, trunc, trunc);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, round, round);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, roundEven, roundEven);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, ceil, ceil);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Vec, fract, fract);
-
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_2ARGS(Vec, Vec, mod, mod);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_2ARGS_SIMD4(Vec, Vec, pow, pow, Pow);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS_SIMD4(Vec, Vec, exp, exp, Exp);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS_SIMD4(Vec, Vec, log, log, Log);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS_SIMD4(Vec, Vec, exp2, exp2, Exp2);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS_SIMD4(Vec, Vec, log2, log2, Log2);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS_SIMD(Vec, Vec, sqrt, sqrt, Sqrt);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS_SIMD(Vec, Vec, invertsqrt, invertsqrt, InvertSqrt);
+
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS_SIMD(Vec, Vec, abs, abs, Abs);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS_SIMD(Ivec, Ivec, abs, abs, Abs);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS_SIMD(Vec, Vec, sign, sign, Sign);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS_SIMD(Ivec, Ivec, sign, sign, Sign);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS_SIMD(Vec, Vec, floor, floor, Floor);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS_SIMD(Vec, Vec, trunc, trunc, Trunc);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS_SIMD(Vec, Vec, round, round, Round);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS_SIMD(Vec, Vec, roundEven, roundEven, RoundEven);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS_SIMD(Vec, Vec, ceil, ceil, Ceil);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS_SIMD(Vec, Vec, fract, fract, Fract);
+
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_2ARGS_SIMD(Vec, Vec, mod, mod, Mod);
 IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_2ARGS_RET(Vec, Vec, modf, modf);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_2ARGS(Vec, Vec, min, min);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_2ARGS(Vec, Vec, max, max);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_3ARGS(Vec, Vec, clamp, clamp);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_3ARGS(Vec, Vec, mix, mix);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_2ARGS(Vec, Vec, step, step);
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_3ARGS(Vec, Vec, smoothstep, smoothstep);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_2ARGS_SIMD(Vec, Vec, min, min, Min);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_2ARGS_SIMD(Vec, Vec, max, max, Max);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_3ARGS_SIMD(Vec, Vec, clamp, clamp, Clamp);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_2ARGS_SIMD(Ivec, Ivec, min, min, Min);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_2ARGS_SIMD(Ivec, Ivec, max, max, Max);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_3ARGS_SIMD(Ivec, Ivec, clamp, clamp, Clamp);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_3ARGS_SIMD(Vec, Vec, mix, mix, Mix);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_2ARGS_SIMD(Vec, Vec, step, step, Step);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_3ARGS_SIMD(Vec, Vec, smoothstep, smoothstep, SmoothStep);
 
 IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Bvec, isnan, isnan);
 IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_1ARGS(Vec, Bvec, isinf, isinf);
 
+/* sincos（1 回の引数還元で sin と cos を同時に求める）*/
+template<typename Element_t, typename Traits_t, int recursiveCount>
+static inline void sincos(
+	const Vec<Element_t, Traits_t, recursiveCount> &rParam,
+	GenVec2<Element_t, Traits_t::opeDim, Traits_t::tempMemDim> &rSin,
+	GenVec2<Element_t, Traits_t::opeDim, Traits_t::tempMemDim> &rCos
+){
+	static_assert(Traits_t::isValid);
+	if constexpr (GLSLMATH_USE_SIMD_TRANSCENDENTAL && SimdPath<Element_t, Traits_t>::isReadable) {
+		using SimdVecTraits_t = GenSimdVecTraits<Element_t, Traits_t::memDim>;
+		SimdVecTraits_t::template SinCos<Traits_t::opeDim>(rParam.GetSimdVec(), rSin.simdVec, rCos.simdVec);
+		rCos.simdVec = SimdPath<Element_t, Traits_t>::ClearPadding(rCos.simdVec);
+	} else if constexpr (GLSLMATH_USE_SIMD_TRANSCENDENTAL && GenSimdVecTraits<Element_t, 4>::isSimd) {
+		using SimdVecTraits_t = GenSimdVecTraits<Element_t, 4>;
+		typename SimdVecTraits_t::IntrinsicType_t sinA, cosA;
+		SimdVecTraits_t::template SinCos<Traits_t::opeDim>(SimdPath<Element_t, Traits_t>::LoadWidened(rParam.elements), sinA, cosA);
+		SimdVecTraits_t::template StorePartial<Traits_t::opeDim>(rSin.elements, sinA);
+		SimdVecTraits_t::template StorePartial<Traits_t::opeDim>(rCos.elements, cosA);
+	} else {
+		if constexpr (Traits_t::opeDim >= 1) { sincos(rParam.elements[Traits_t::i0], rSin.elements[0], rCos.elements[0]); }
+		if constexpr (Traits_t::opeDim >= 2) { sincos(rParam.elements[Traits_t::i1], rSin.elements[1], rCos.elements[1]); }
+		if constexpr (Traits_t::opeDim >= 3) { sincos(rParam.elements[Traits_t::i2], rSin.elements[2], rCos.elements[2]); }
+		if constexpr (Traits_t::opeDim >= 4) { sincos(rParam.elements[Traits_t::i3], rSin.elements[3], rCos.elements[3]); }
+		rSin.ClearPadding();
+		rCos.ClearPadding();
+	}
+}
+
+/* pow（指数がコンパイル時定数 numerator / denominator の場合。例：pow<2>(v)、pow<1, 2>(v)）*/
+template<int numerator, int denominator = 1, typename Element_t, typename Traits_t, int recursiveCount>
+static inline GenVec2<Element_t, Traits_t::opeDim, Traits_t::tempMemDim> pow(
+	const Vec<Element_t, Traits_t, recursiveCount> &rParam
+){
+	static_assert(Traits_t::isValid);
+	GenVec2<Element_t, Traits_t::opeDim, Traits_t::tempMemDim> result;
+	if constexpr (SimdPath<Element_t, Traits_t>::isReadable) {
+		using SimdVecTraits_t = GenSimdVecTraits<Element_t, Traits_t::memDim>;
+		result.simdVec = SimdPath<Element_t, Traits_t>::ClearPadding(
+			SimdVecTraits_t::template PowConst<numerator, denominator>(SimdPath<Element_t, Traits_t>::template PadOperand<1>(rParam.GetSimdVec()))
+		);
+	} else if constexpr (GenSimdVecTraits<Element_t, 4>::isSimd) {
+		using SimdVecTraits_t = GenSimdVecTraits<Element_t, 4>;
+		SimdVecTraits_t::template StorePartial<Traits_t::opeDim>(
+			result.elements, SimdVecTraits_t::template PowConst<numerator, denominator>(SimdPath<Element_t, Traits_t>::LoadWidened(rParam.elements))
+		);
+	} else {
+		if constexpr (Traits_t::opeDim >= 1) { result.elements[0] = pow<numerator, denominator>(rParam.elements[Traits_t::i0]); }
+		if constexpr (Traits_t::opeDim >= 2) { result.elements[1] = pow<numerator, denominator>(rParam.elements[Traits_t::i1]); }
+		if constexpr (Traits_t::opeDim >= 3) { result.elements[2] = pow<numerator, denominator>(rParam.elements[Traits_t::i2]); }
+		if constexpr (Traits_t::opeDim >= 4) { result.elements[3] = pow<numerator, denominator>(rParam.elements[Traits_t::i3]); }
+	}
+	return result;
+}
+
+/* mix（a が真の成分は y、偽の成分は x を選ぶ）*/
+template<typename Element_t, typename BoolElement_t, int opeDim, int memDim0, int memDim1, int memDim2, int swizzle0, int swizzle1, int swizzle2, int recursiveCount0, int recursiveCount1, int recursiveCount2>
+static inline GenVec2<Element_t, opeDim, Traits<opeDim, memDim0, swizzle0>::tempMemDim>
+mix(
+	const Vec<Element_t, Traits<opeDim, memDim0, swizzle0>, recursiveCount0> &rParam0,
+	const Vec<Element_t, Traits<opeDim, memDim1, swizzle1>, recursiveCount1> &rParam1,
+	const Bvec<BoolElement_t, Traits<opeDim, memDim2, swizzle2>, recursiveCount2> &rParam2
+){
+	using Traits0_t = Traits<opeDim, memDim0, swizzle0>;
+	using Traits1_t = Traits<opeDim, memDim1, swizzle1>;
+	using Traits2_t = Traits<opeDim, memDim2, swizzle2>;
+	static_assert(Traits0_t::isValid);
+	static_assert(Traits1_t::isValid);
+	static_assert(Traits2_t::isValid);
+	GenVec2<Element_t, opeDim, Traits0_t::tempMemDim> result;
+	if constexpr (
+		std::is_same_v<Element_t, float>
+	&&	std::is_same_v<BoolElement_t, LaneBool>
+	&&	memDim0 == memDim1
+	&&	memDim0 == memDim2
+	&&	SimdPath<Element_t, Traits0_t>::isReadable
+	&&	SimdPath<Element_t, Traits1_t>::isReadable
+	&&	SimdPath<BoolElement_t, Traits2_t>::isReadable
+	) {
+		/* マスクによる選択 */
+		using SimdVecTraits_t = GenSimdVecTraits<Element_t, memDim0>;
+		result.simdVec = SimdVecTraits_t::Select(rParam2.GetSimdVec(), rParam1.GetSimdVec(), rParam0.GetSimdVec());
+		return result;
+	}
+	if constexpr (opeDim >= 1) { result.elements[0] = mix(rParam0.elements[Traits0_t::i0], rParam1.elements[Traits1_t::i0], static_cast<bool>(rParam2.elements[Traits2_t::i0])); }
+	if constexpr (opeDim >= 2) { result.elements[1] = mix(rParam0.elements[Traits0_t::i1], rParam1.elements[Traits1_t::i1], static_cast<bool>(rParam2.elements[Traits2_t::i1])); }
+	if constexpr (opeDim >= 3) { result.elements[2] = mix(rParam0.elements[Traits0_t::i2], rParam1.elements[Traits1_t::i2], static_cast<bool>(rParam2.elements[Traits2_t::i2])); }
+	if constexpr (opeDim >= 4) { result.elements[3] = mix(rParam0.elements[Traits0_t::i3], rParam1.elements[Traits1_t::i3], static_cast<bool>(rParam2.elements[Traits2_t::i3])); }
+	return result;
+}
+
 
 template<typename Traits_t, int recursiveCount>
 static inline GenIvec<int, Traits_t::opeDim> floatBitsToInt(
@@ -2369,7 +5224,7 @@ static inline GenVec<float, Traits_t::opeDim> uintBitsToFloat(
 	return result;
 }
 
-IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_3ARGS(Vec, Vec, fma, fma);
+IMPL_VEC_NON_MEMBER_ELEMENTWISE_FUNCTION_3ARGS_SIMD(Vec, Vec, fma, fma, FusedMulAdd);
 
 template<typename Element_t, int opeDim, int memDim0, int memDim1, int swizzle0, int swizzle1, int recursiveCount0, int recursiveCount1>
 static inline GenVec<Element_t, opeDim>
@@ -2436,6 +5291,10 @@ static inline Element_t dot(
 	using Traits1_t = Traits<opeDim, memDim1, swizzle1>;
 	static_assert(Traits0_t::isValid);
 	static_assert(Traits1_t::isValid);
+	if constexpr (memDim0 == memDim1 && GenSimdVecTraits<Element_t, memDim0>::isSimd) {
+		/* 演算次元を超える成分（パディングや SWIZZLE で参照されない成分）の積は捨てられる */
+		return GenSimdVecTraits<Element_t, memDim0>::template Dot<opeDim>(rParam0.GetSimdVec(), rParam1.GetSimdVec());
+	}
 	Element_t tmp = 0;
 	if constexpr (Traits0_t::opeDim >= 1) { tmp += rParam0.elements[Traits0_t::i0] * rParam1.elements[Traits1_t::i0]; }
 	if constexpr (Traits0_t::opeDim >= 2) { tmp += rParam0.elements[Traits0_t::i1] * rParam1.elements[Traits1_t::i1]; }
@@ -2453,7 +5312,7 @@ static inline double dot(double x, double y){
 
 /* cross */
 template<typename Element_t, int memDim0, int memDim1, int swizzle0, int swizzle1, int recursiveCount0, int recursiveCount1>
-static inline GenVec<Element_t, 3> cross(
+static inline auto cross(
 	const Vec<Element_t, Traits<3, memDim0, swizzle0>, recursiveCount0> &rParam0,
 	const Vec<Element_t, Traits<3, memDim1, swizzle1>, recursiveCount1> &rParam1
 ){
@@ -2461,13 +5320,29 @@ static inline GenVec<Element_t, 3> cross(
 	using Traits1_t = Traits<3, memDim1, swizzle1>;
 	static_assert(Traits0_t::isValid);
 	static_assert(Traits1_t::isValid);
-	return
-		GenVec<Element_t, 3>(
-			rParam0.elements[Traits0_t::i1] * rParam1.elements[Traits1_t::i2] - rParam0.elements[Traits0_t::i2] * rParam1.elements[Traits1_t::i1],
-			rParam0.elements[Traits0_t::i2] * rParam1.elements[Traits1_t::i0] - rParam0.elements[Traits0_t::i0] * rParam1.elements[Traits1_t::i2],
-			rParam0.elements[Traits0_t::i0] * rParam1.elements[Traits1_t::i1] - rParam0.elements[Traits0_t::i1] * rParam1.elements[Traits1_t::i0]
-		)
-	;
+	using SimdVecTraits_t = GenSimdVecTraits<Element_t, 4>;
+	if constexpr (memDim0 == 4 && memDim1 == 4 && SimdVecTraits_t::isSimd) {
+		/*
+			vec3a や vec4 の 3 成分 SWIZZLE は 4 成分のレジスタ上で求める。
+			成分 3 の値は不定だが、結果がパディング付きでなければ書き込まれない。
+		*/
+		GenVec2<Element_t, 3, Traits0_t::tempMemDim> result;
+		const auto simdVec = SimdVecTraits_t::Cross3(rParam0.GetSimdVec(), rParam1.GetSimdVec());
+		if constexpr (Traits0_t::tempMemDim == 4) {
+			result.simdVec = simdVec;
+		} else {
+			SimdVecTraits_t::template StorePartial<3>(result.elements, simdVec);
+		}
+		return result;
+	} else {
+		return
+			GenVec2<Element_t, 3, Traits0_t::tempMemDim>(
+				rParam0.elements[Traits0_t::i1] * rParam1.elements[Traits1_t::i2] - rParam0.elements[Traits0_t::i2] * rParam1.elements[Traits1_t::i1],
+				rParam0.elements[Traits0_t::i2] * rParam1.elements[Traits1_t::i0] - rParam0.elements[Traits0_t::i0] * rParam1.elements[Traits1_t::i2],
+				rParam0.elements[Traits0_t::i0] * rParam1.elements[Traits1_t::i1] - rParam0.elements[Traits0_t::i1] * rParam1.elements[Traits1_t::i0]
+			)
+		;
+	}
 }
 
 
@@ -2477,6 +5352,11 @@ static inline Element0_t length(
 	const Vec<Element0_t, Traits0_t, recursiveCount0> &rVec
 ){
 	static_assert(Traits0_t::isValid);
+	using SimdVecTraits_t = GenSimdVecTraits<Element0_t, Traits0_t::memDim>;
+	if constexpr (SimdVecTraits_t::isSimd) {
+		const auto simdVec = rVec.GetSimdVec();
+		return SimdVecTraits_t::ExtractFirst(SimdVecTraits_t::Sqrt(SimdVecTraits_t::template DotBroadcast<Traits0_t::opeDim>(simdVec, simdVec)));
+	}
 	return std::sqrt(dot(rVec, rVec));
 }
 static inline float length(float x){
@@ -2497,7 +5377,18 @@ static inline Element_t distance(
 	using Traits1_t = Traits<opeDim, memDim1, swizzle1>;
 	static_assert(Traits0_t::isValid);
 	static_assert(Traits1_t::isValid);
-	return length(rVec1 - rVec0);
+	using SimdVecTraits_t = GenSimdVecTraits<Element_t, memDim0>;
+	if constexpr (memDim0 == memDim1 && SimdVecTraits_t::isSimd) {
+		/* 差をレジスタ上に保持したまま 2 乗和を求める */
+		const auto diff = SimdVecTraits_t::Sub(rVec1.GetSimdVec(), rVec0.GetSimdVec());
+		return SimdVecTraits_t::ExtractFirst(SimdVecTraits_t::Sqrt(SimdVecTraits_t::template DotBroadcast<opeDim>(diff, diff)));
+	}
+	Element_t tmp = 0;
+	if constexpr (opeDim >= 1) { const Element_t d = rVec1.elements[Traits1_t::i0] - rVec0.elements[Traits0_t::i0]; tmp += d * d; }
+	if constexpr (opeDim >= 2) { const Element_t d = rVec1.elements[Traits1_t::i1] - rVec0.elements[Traits0_t::i1]; tmp += d * d; }
+	if constexpr (opeDim >= 3) { const Element_t d = rVec1.elements[Traits1_t::i2] - rVec0.elements[Traits0_t::i2]; tmp += d * d; }
+	if constexpr (opeDim >= 4) { const Element_t d = rVec1.elements[Traits1_t::i3] - rVec0.elements[Traits0_t::i3]; tmp += d * d; }
+	return std::sqrt(tmp);
 }
 static inline float distance(float x, float y){
 	return std::abs(y - x);
@@ -2509,12 +5400,22 @@ static inline double distance(double x, double y){
 
 /* normalize */
 template<typename Element0_t, typename Traits0_t, int recursiveCount0>
-static inline GenVec<Element0_t, Traits0_t::opeDim> normalize(
+static inline GenVec2<Element0_t, Traits0_t::opeDim, Traits0_t::tempMemDim> normalize(
 	const Vec<Element0_t, Traits0_t, recursiveCount0> &rVec
 ){
 	static_assert(Traits0_t::isValid);
-	Element0_t length2 = dot(rVec, rVec);
-	return rVec * invertsqrt(length2);
+	if constexpr (SimdPath<Element0_t, Traits0_t>::isReadable) {
+		/* 2 乗和をブロードキャストしたまま逆平方根を求め、スカラを経由しない */
+		using SimdVecTraits_t = GenSimdVecTraits<Element0_t, Traits0_t::memDim>;
+		GenVec2<Element0_t, Traits0_t::opeDim, Traits0_t::tempMemDim> result;
+		const auto simdVec = rVec.GetSimdVec();
+		result.simdVec = SimdVecTraits_t::Mul(
+			simdVec,
+			SimdVecTraits_t::InvertSqrt(SimdVecTraits_t::template DotBroadcast<Traits0_t::opeDim>(simdVec, simdVec))
+		);
+		return result;
+	}
+	return rVec * invertsqrt(dot(rVec, rVec));
 }
 static inline float normalize(float x){
 	(void)x;
@@ -2525,6 +5426,77 @@ static inline double normalize(double x){
 	return 1;
 }
 
+/*
+	配列の一括正規化（pResult と pParam は同じ配列でもよい）
+	4 成分の SIMD 型がある場合、4 本ずつ成分ごとの並びに組み替えて 2 乗和を求め、
+	4 本分の逆平方根を 1 回で求める。端数はベクトルごとに normalize する。
+*/
+template<typename Element_t, int opeDim, int memDim>
+static inline void normalizeArray(
+	GenVec2<Element_t, opeDim, memDim> *pResult,
+	const GenVec2<Element_t, opeDim, memDim> *pParam,
+	std::size_t count
+){
+	using SimdVecTraits_t = GenSimdVecTraits<Element_t, 4>;
+	using Intrinsic_t = typename SimdVecTraits_t::IntrinsicType_t;
+	std::size_t i = 0;
+	if constexpr (SimdVecTraits_t::isSimd && opeDim >= 3 && memDim == 4) {
+		/* vec4 vec3a：4 本を転置して x y z (w) の並びにする */
+		for (; i + 4 <= count; i += 4) {
+			const Intrinsic_t v0 = pParam[i + 0].simdVec;
+			const Intrinsic_t v1 = pParam[i + 1].simdVec;
+			const Intrinsic_t v2 = pParam[i + 2].simdVec;
+			const Intrinsic_t v3 = pParam[i + 3].simdVec;
+			Intrinsic_t x = v0, y = v1, z = v2, w = v3;
+			SimdVecTraits_t::Transpose4(x, y, z, w);
+			Intrinsic_t length2 = SimdVecTraits_t::Mul(x, x);
+			length2 = SimdVecTraits_t::MulAdd(y, y, length2);
+			length2 = SimdVecTraits_t::MulAdd(z, z, length2);
+			if constexpr (opeDim == 4) {
+				length2 = SimdVecTraits_t::MulAdd(w, w, length2);
+			}
+			const Intrinsic_t inv = SimdVecTraits_t::InvertSqrt(length2);
+			pResult[i + 0].simdVec = SimdVecTraits_t::Mul(v0, SimdVecTraits_t::template Swizzle<0x0000>(inv));
+			pResult[i + 1].simdVec = SimdVecTraits_t::Mul(v1, SimdVecTraits_t::template Swizzle<0x1111>(inv));
+			pResult[i + 2].simdVec = SimdVecTraits_t::Mul(v2, SimdVecTraits_t::template Swizzle<0x2222>(inv));
+			pResult[i + 3].simdVec = SimdVecTraits_t::Mul(v3, SimdVecTraits_t::template Swizzle<0x3333>(inv));
+		}
+	} else if constexpr (SimdVecTraits_t::isSimd && opeDim == 3 && memDim == 3) {
+		/*
+			vec3：4 本分の 12 成分を 3 本のレジスタで読み込む。
+				a = (x0 y0 z0 x1) b = (y1 z1 x2 y2) c = (z2 x3 y3 z3)
+			ブレンドと SWIZZLE で x y z の並びを作り、逆平方根を同じ配置に並べ直して乗算する。
+		*/
+		static_assert(sizeof(GenVec2<Element_t, opeDim, memDim>) == sizeof(Element_t) * 3);
+		for (; i + 4 <= count; i += 4) {
+			const Element_t *pSrc = pParam[i].elements;
+			const Intrinsic_t a = SimdVecTraits_t::template LoadPartial<4>(pSrc + 0);
+			const Intrinsic_t b = SimdVecTraits_t::template LoadPartial<4>(pSrc + 4);
+			const Intrinsic_t c = SimdVecTraits_t::template LoadPartial<4>(pSrc + 8);
+			const Intrinsic_t x = SimdVecTraits_t::template Swizzle<0x1230>(
+				SimdVecTraits_t::template Blend<0x4>(SimdVecTraits_t::template Blend<0x2>(a, c), b)
+			);
+			const Intrinsic_t y = SimdVecTraits_t::template Swizzle<0x2301>(
+				SimdVecTraits_t::template Blend<0x4>(SimdVecTraits_t::template Blend<0x9>(a, b), c)
+			);
+			const Intrinsic_t z = SimdVecTraits_t::template Swizzle<0x3012>(
+				SimdVecTraits_t::template Blend<0x2>(SimdVecTraits_t::template Blend<0x9>(a, c), b)
+			);
+			Intrinsic_t length2 = SimdVecTraits_t::Mul(x, x);
+			length2 = SimdVecTraits_t::MulAdd(y, y, length2);
+			length2 = SimdVecTraits_t::MulAdd(z, z, length2);
+			const Intrinsic_t inv = SimdVecTraits_t::InvertSqrt(length2);
+			Element_t *pDst = pResult[i].elements;
+			SimdVecTraits_t::template StorePartial<4>(pDst + 0, SimdVecTraits_t::Mul(a, SimdVecTraits_t::template Swizzle<0x1000>(inv)));
+			SimdVecTraits_t::template StorePartial<4>(pDst + 4, SimdVecTraits_t::Mul(b, SimdVecTraits_t::template Swizzle<0x2211>(inv)));
+			SimdVecTraits_t::template StorePartial<4>(pDst + 8, SimdVecTraits_t::Mul(c, SimdVecTraits_t::template Swizzle<0x3332>(inv)));
+		}
+	}
+	for (; i < count; ++i) {
+		pResult[i] = normalize(pParam[i]);
+	}
+}
+
 
 /* reflect */
 template<typename Element_t, int opeDim, int memDim0, int memDim1, int swizzle0, int swizzle1, int recursiveCount0, int recursiveCount1>
@@ -2585,6 +5557,41 @@ static inline double refract(double param0, double param1, double eta){
 	}
 }
 
+/*
+	パディング無しの 3 次元ベクトル配列とパディング付きの配列の相互変換（vec3 <-> vec3a dvec3 <-> dvec3a）
+	配列の格納には vec3 を、演算には vec3a を用いる場合に使う。パディング成分は 0 で埋める。
+*/
+template<typename Element_t>
+static inline void toPadded(
+	GenVec2<Element_t, 3, 4> *pDst,
+	const GenVec<Element_t, 3> *pSrc,
+	std::size_t count
+){
+	using SimdVecTraits_t = GenSimdVecTraits<Element_t, 4>;
+	for (std::size_t i = 0; i < count; ++i) {
+		if constexpr (SimdVecTraits_t::isSimd) {
+			pDst[i].simdVec = SimdVecTraits_t::template LoadPartial<3>(pSrc[i].elements);
+		} else {
+			pDst[i] = GenVec2<Element_t, 3, 4>(pSrc[i]);
+		}
+	}
+}
+template<typename Element_t>
+static inline void toPacked(
+	GenVec<Element_t, 3> *pDst,
+	const GenVec2<Element_t, 3, 4> *pSrc,
+	std::size_t count
+){
+	using SimdVecTraits_t = GenSimdVecTraits<Element_t, 4>;
+	for (std::size_t i = 0; i < count; ++i) {
+		if constexpr (SimdVecTraits_t::isSimd) {
+			SimdVecTraits_t::template StorePartial<3>(pDst[i].elements, pSrc[i].simdVec);
+		} else {
+			pDst[i] = GenVec<Element_t, 3>(pSrc[i]);
+		}
+	}
+}
+
 /*
 	@@
 	faceforward
@@ -2613,11 +5620,33 @@ static inline double refract(double param0, double param1, double eta){
 -----------------------------------------------------------------------------*/
 /* matrixCompMult */
 template<typename Element_t, int opeDimC, int memDimC0, int memDimC1, int opeDimR, int memDimR0, int memDimR1, int recursiveCount0, int recursiveCount1>
-static inline GenMat<Element_t, opeDimC, opeDimR> matrixCompMult(
+static inline GenMat2<Element_t, opeDimC, opeDimR, MatTraits<opeDimC, memDimC0, opeDimR, memDimR0, recursiveCount0>::tempMemDimR> matrixCompMult(
 	const Mat<Element_t, opeDimC, memDimC0, opeDimR, memDimR0, recursiveCount0> &rParam0,
 	const Mat<Element_t, opeDimC, memDimC1, opeDimR, memDimR1, recursiveCount1> &rParam1
 ){
-	GenMat<Element_t, opeDimC, opeDimR> result;
+	enum { resultMemDimR = MatTraits<opeDimC, memDimC0, opeDimR, memDimR0, recursiveCount0>::tempMemDimR };
+	GenMat2<Element_t, opeDimC, opeDimR, resultMemDimR> result;
+	using MatSimdTraits_t = GenSimdMatTraits<Element_t, opeDimC, opeDimR>;
+	using SimdVecTraits_t = GenSimdVecTraits<Element_t, memDimR0>;
+	if constexpr (
+		MatSimdTraits_t::isSimd
+	&&	opeDimC == memDimC0 && opeDimR == memDimR0
+	&&	opeDimC == memDimC1 && opeDimR == memDimR1
+	) {
+		result.simdMat = MatSimdTraits_t::SimdVecTraits_t::Mul(rParam0.simdMat, rParam1.simdMat);
+		return result;
+	} else if constexpr (SimdVecTraits_t::isSimd && memDimR0 == memDimR1) {
+		/* 列ごとに SIMD レジスタ上で乗算する（列の余剰成分の積は、パディング付きの結果以外では書き込まない）*/
+		for (int i = 0; i < opeDimC; ++i) {
+			const auto simdVec = SimdVecTraits_t::Mul(rParam0.columns[i].simdVec, rParam1.columns[i].simdVec);
+			if constexpr (resultMemDimR == memDimR0) {
+				result.columns[i].simdVec = simdVec;
+			} else {
+				SimdVecTraits_t::template StorePartial<opeDimR>(result.columns[i].elements, simdVec);
+			}
+		}
+		return result;
+	}
 	if constexpr (opeDimC >= 1) { result.columns[0] = rParam0.columns[0] * rParam1.columns[0]; }
 	if constexpr (opeDimC >= 2) { result.columns[1] = rParam0.columns[1] * rParam1.columns[1]; }
 	if constexpr (opeDimC >= 3) { result.columns[2] = rParam0.columns[2] * rParam1.columns[2]; }
@@ -2626,45 +5655,102 @@ static inline GenMat<Element_t, opeDimC, opeDimR> matrixCompMult(
 }
 
 /* outerProduct */
+/*
+	列 j は rVec0 * rVec1[j]。
+
+	              opeDim1
+
+	■              ■■■□
+	■ * ■■■□ = ■■■□ opeDim0
+	□              □□□□
+	□              □□□□
+*/
 template<typename Element_t, int opeDim0, int memDim0, int swizzle0, int opeDim1, int memDim1, int swizzle1, int recursiveCount0, int recursiveCount1>
-static inline GenMat<Element_t, opeDim1, opeDim0> outerProduct(
+static inline GenMat2<Element_t, opeDim1, opeDim0, Traits<opeDim0, memDim0, swizzle0>::tempMemDim> outerProduct(
 	const Vec<Element_t, Traits<opeDim0, memDim0, swizzle0>, recursiveCount0> &rVec0,
 	const Vec<Element_t, Traits<opeDim1, memDim1, swizzle1>, recursiveCount1> &rVec1
 ){
-	/*
-		       ■
-		matC = ■ opeDim0
-		       □
-		       □
-
-
-		       opeDim1
-
-		matR = ■■■□
-
-		                              opeDim1
-
-		              ■              ■■■□
-		matC * matR = ■ * ■■■□ = ■■■□ opeDim0
-		              □              □□□□
-		              □              □□□□
-	*/
+	using Traits0_t = Traits<opeDim0, memDim0, swizzle0>;
 	using Traits1_t = Traits<opeDim1, memDim1, swizzle1>;
-	GenMat<Element_t, 1, opeDim0> matC(rVec0);
-	GenMat<Element_t, opeDim1, 1> matR;
-	if constexpr (opeDim1 >= 1) { matR.columns[0].elements[0] = rVec1.elements[Traits1_t::i0]; }
-	if constexpr (opeDim1 >= 2) { matR.columns[1].elements[0] = rVec1.elements[Traits1_t::i1]; }
-	if constexpr (opeDim1 >= 3) { matR.columns[2].elements[0] = rVec1.elements[Traits1_t::i2]; }
-	if constexpr (opeDim1 >= 4) { matR.columns[3].elements[0] = rVec1.elements[Traits1_t::i3]; }
-	return matC * matR;
+	static_assert(Traits0_t::isValid);
+	static_assert(Traits1_t::isValid);
+	GenMat2<Element_t, opeDim1, opeDim0, Traits0_t::tempMemDim> result;
+	using MatSimdTraits_t = GenSimdMatTraits<Element_t, opeDim1, opeDim0>;
+	using SimdVecTraits_t = GenSimdVecTraits<Element_t, memDim0>;
+	if constexpr (MatSimdTraits_t::isSimd && opeDim0 == 2 && opeDim1 == 2) {
+		/* (c0, c1, c0, c1) * (r0, r0, r1, r1) を 1 本のレジスタで計算する */
+		using MatSimdVecTraits_t = typename MatSimdTraits_t::SimdVecTraits_t;
+		const Element_t aC[2] = { rVec0.elements[Traits0_t::i0], rVec0.elements[Traits0_t::i1] };
+		const Element_t aR[2] = { rVec1.elements[Traits1_t::i0], rVec1.elements[Traits1_t::i1] };
+		result.simdMat = MatSimdVecTraits_t::Mul(
+			MatSimdVecTraits_t::template Swizzle<0x1010>(MatSimdVecTraits_t::template LoadPartial<2>(aC)),
+			MatSimdVecTraits_t::template Swizzle<0x1100>(MatSimdVecTraits_t::template LoadPartial<2>(aR))
+		);
+		return result;
+	} else if constexpr (SimdPath<Element_t, Traits0_t>::isReadable) {
+		/* rVec0 は SIMD レジスタに保持したまま、rVec1 の各成分をブロードキャストして乗算する */
+		const auto simdVec0 = rVec0.GetSimdVec();
+		for (int j = 0; j < opeDim1; ++j) {
+			result.columns[j].simdVec = SimdVecTraits_t::Mul(simdVec0, SimdVecTraits_t::Set1(rVec1.elements[(swizzle1 >> (j * 4)) & 15]));
+		}
+		return result;
+	}
+	if constexpr (opeDim1 >= 1) { result.columns[0] = rVec0 * rVec1.elements[Traits1_t::i0]; }
+	if constexpr (opeDim1 >= 2) { result.columns[1] = rVec0 * rVec1.elements[Traits1_t::i1]; }
+	if constexpr (opeDim1 >= 3) { result.columns[2] = rVec0 * rVec1.elements[Traits1_t::i2]; }
+	if constexpr (opeDim1 >= 4) { result.columns[3] = rVec0 * rVec1.elements[Traits1_t::i3]; }
+	return result;
 }
 
 /* transpose */
 template<typename Element_t, int opeDimC, int memDimC, int opeDimR, int memDimR, int recursiveCount>
-static inline GenMat<Element_t, opeDimR, opeDimC> transpose(
+static inline GenMat2<Element_t, opeDimR, opeDimC, MatTraits<opeDimC, memDimC, opeDimR, memDimR, recursiveCount>::tempMemDimC> transpose(
 	const Mat<Element_t, opeDimC, memDimC, opeDimR, memDimR, recursiveCount> &rParam
 ){
-	GenMat<Element_t, opeDimR, opeDimC> result;
+	enum { resultMemDimR = MatTraits<opeDimC, memDimC, opeDimR, memDimR, recursiveCount>::tempMemDimC };
+	GenMat2<Element_t, opeDimR, opeDimC, resultMemDimR> result;
+	using MatSimdTraits_t = GenSimdMatTraits<Element_t, memDimC, memDimR>;
+	if constexpr (MatSimdTraits_t::isSimd && opeDimC == 2 && opeDimR == 2 && memDimC == 2 && memDimR == 2) {
+		/* 行列全体を 1 本のレジスタ上で並べ替える */
+		result.simdMat = MatSimdTraits_t::SimdVecTraits_t::Transpose2x2(rParam.simdMat);
+		return result;
+	}
+	using SimdVecTraits_t = GenSimdVecTraits<Element_t, 4>;
+	if constexpr (
+		SimdVecTraits_t::isSimd
+	&&	opeDimC >= 3 && opeDimR >= 3
+	&&	(memDimR == 4 || (memDimR == 3 && !GenSimdVecTraits<Element_t, 3>::isSimd))
+	) {
+		/*
+			列を 4 本のレジスタに読み込み、レジスタ上で 4x4 転置してから書き戻す。
+			3 成分の列は、最後の列以外は次の列の先頭成分まで含めて 4 成分で読み書きする
+			（はみ出した成分は転置後の 4 行目に移るので捨てられる。書き込みは列の昇順に行い、
+			はみ出して書いた成分を次の列の書き込みで上書きする）。
+		*/
+		typename SimdVecTraits_t::IntrinsicType_t r[4];
+		for (int i = 0; i < 4; ++i) {
+			if (i >= opeDimC) {
+				r[i] = SimdVecTraits_t::Set1(Element_t(0));
+			} else if constexpr (memDimR == 4) {
+				r[i] = rParam.columns[i].simdVec;
+			} else if (i < opeDimC - 1) {
+				r[i] = SimdVecTraits_t::template LoadPartial<4>(rParam.columns[i].elements);
+			} else {
+				r[i] = SimdVecTraits_t::template LoadPartial<3>(rParam.columns[i].elements);
+			}
+		}
+		SimdVecTraits_t::Transpose4(r[0], r[1], r[2], r[3]);
+		for (int i = 0; i < opeDimR; ++i) {
+			if constexpr (resultMemDimR == 4) {
+				result.columns[i].simdVec = r[i];
+			} else if (i < opeDimR - 1) {
+				SimdVecTraits_t::template StorePartial<4>(result.columns[i].elements, r[i]);
+			} else {
+				SimdVecTraits_t::template StorePartial<3>(result.columns[i].elements, r[i]);
+			}
+		}
+		return result;
+	}
 	if constexpr (opeDimC >= 1) {
 		if constexpr (opeDimR >= 1) { result.columns[0].elements[0] = rParam.columns[0].elements[0]; }
 		if constexpr (opeDimR >= 2) { result.columns[1].elements[0] = rParam.columns[0].elements[1]; }
@@ -2697,6 +5783,11 @@ template<typename Element_t, int memDimC, int memDimR, int recursiveCount>
 static inline Element_t determinant(
 	const Mat<Element_t, 2, memDimC, 2, memDimR, recursiveCount> &rParam
 ){
+	using MatSimdTraits_t = GenSimdMatTraits<Element_t, memDimC, memDimR>;
+	if constexpr (MatSimdTraits_t::isSimd && memDimC == 2 && memDimR == 2) {
+		using SimdVecTraits_t = typename MatSimdTraits_t::SimdVecTraits_t;
+		return SimdVecTraits_t::ExtractFirst(SimdVecTraits_t::Determinant2x2(rParam.simdMat));
+	}
 	return
 		rParam.columns[0].elements[0] * rParam.columns[1].elements[1]
 	-	rParam.columns[1].elements[0] * rParam.columns[0].elements[1];
@@ -2705,6 +5796,13 @@ template<typename Element_t, int memDimC, int memDimR, int recursiveCount>
 static inline Element_t determinant(
 	const Mat<Element_t, 3, memDimC, 3, memDimR, recursiveCount> &rParam
 ){
+	using SimdVecTraits_t = GenSimdVecTraits<Element_t, memDimR>;
+	if constexpr (SimdVecTraits_t::isSimd && memDimR == 4) {
+		const typename SimdVecTraits_t::IntrinsicType_t aColumn[3] = {
+			rParam.columns[0].simdVec, rParam.columns[1].simdVec, rParam.columns[2].simdVec
+		};
+		return SimdVecTraits_t::ExtractFirst(SimdVecTraits_t::Determinant3x3(aColumn));
+	}
 	return
 		rParam.columns[0].elements[0]
 	*	(	rParam.columns[1].elements[1] * rParam.columns[2].elements[2]
@@ -2724,6 +5822,13 @@ template<typename Element_t, int memDimC, int memDimR, int recursiveCount>
 static inline Element_t determinant(
 	const Mat<Element_t, 4, memDimC, 4, memDimR, recursiveCount> &rParam
 ){
+	using SimdVecTraits_t = GenSimdVecTraits<Element_t, memDimR>;
+	if constexpr (SimdVecTraits_t::isSimd && memDimR == 4) {
+		const typename SimdVecTraits_t::IntrinsicType_t aColumn[4] = {
+			rParam.columns[0].simdVec, rParam.columns[1].simdVec, rParam.columns[2].simdVec, rParam.columns[3].simdVec
+		};
+		return SimdVecTraits_t::ExtractFirst(SimdVecTraits_t::Determinant4x4(aColumn));
+	}
 	Element_t tmp0	= rParam.columns[2].elements[2] * rParam.columns[3].elements[3]
 					- rParam.columns[3].elements[2] * rParam.columns[2].elements[3];
 	Element_t tmp1	= rParam.columns[2].elements[1] * rParam.columns[3].elements[3]
@@ -2753,6 +5858,12 @@ template<typename Element_t, int memDimC, int memDimR, int recursiveCount>
 static inline GenMat<Element_t, 2, 2> inverse(
 	const Mat<Element_t, 2, memDimC, 2, memDimR, recursiveCount> &rParam
 ){
+	using MatSimdTraits_t = GenSimdMatTraits<Element_t, memDimC, memDimR>;
+	if constexpr (MatSimdTraits_t::isSimd && memDimC == 2 && memDimR == 2) {
+		GenMat<Element_t, 2, 2> result;
+		MatSimdTraits_t::SimdVecTraits_t::Inverse2x2(rParam.simdMat, result.simdMat);
+		return result;
+	}
 	Element_t invDet = Element_t(1) / determinant(rParam);
 	GenMat<Element_t, 2, 2> result = {
 		{
@@ -2766,9 +5877,29 @@ static inline GenMat<Element_t, 2, 2> inverse(
 	return result;
 }
 template<typename Element_t, int memDimC, int memDimR, int recursiveCount>
-static inline GenMat<Element_t, 3, 3> inverse(
+static inline GenMat2<Element_t, 3, 3, MatTraits<3, memDimC, 3, memDimR, recursiveCount>::tempMemDimR> inverse(
 	const Mat<Element_t, 3, memDimC, 3, memDimR, recursiveCount> &rParam
 ){
+	using SimdVecTraits_t = GenSimdVecTraits<Element_t, memDimR>;
+	if constexpr (SimdVecTraits_t::isSimd && memDimR == 4) {
+		/* 列をパディング付きのまま読み込み、全てレジスタ上で計算する */
+		const typename SimdVecTraits_t::IntrinsicType_t aColumn[3] = {
+			rParam.columns[0].simdVec, rParam.columns[1].simdVec, rParam.columns[2].simdVec
+		};
+		typename SimdVecTraits_t::IntrinsicType_t aResult[3];
+		SimdVecTraits_t::Inverse3x3(aColumn, aResult);
+		GenMat2<Element_t, 3, 3, MatTraits<3, memDimC, 3, memDimR, recursiveCount>::tempMemDimR> result;
+		if constexpr (MatTraits<3, memDimC, 3, memDimR, recursiveCount>::tempMemDimR == 4) {
+			result.columns[0].simdVec = aResult[0];
+			result.columns[1].simdVec = aResult[1];
+			result.columns[2].simdVec = aResult[2];
+		} else {
+			SimdVecTraits_t::template StorePartial<3>(result.columns[0].elements, aResult[0]);
+			SimdVecTraits_t::template StorePartial<3>(result.columns[1].elements, aResult[1]);
+			SimdVecTraits_t::template StorePartial<3>(result.columns[2].elements, aResult[2]);
+		}
+		return result;
+	}
 	Element_t invDet = Element_t(1) / determinant(rParam);
 	GenMat<Element_t, 3, 3> result = {
 		{
@@ -2787,10 +5918,30 @@ static inline GenMat<Element_t, 3, 3> inverse(
 	};
 	return result;
 }
+/*
+	4x4 行列の逆行列（行列式も同時に求める）
+	行列式が 0 の場合、戻り値の成分は inf または nan になる。呼び出し側で rDeterminant を調べて破棄すること。
+*/
 template<typename Element_t, int memDimC, int memDimR, int recursiveCount>
 static inline GenMat<Element_t, 4, 4> inverse(
-	const Mat<Element_t, 4, memDimC, 4, memDimR, recursiveCount> &m
+	const Mat<Element_t, 4, memDimC, 4, memDimR, recursiveCount> &m,
+	Element_t &rDeterminant
 ){
+	using SimdVecTraits_t = GenSimdVecTraits<Element_t, memDimR>;
+	if constexpr (SimdVecTraits_t::isSimd && memDimR == 4) {
+		/* 余因子の計算から行列式による除算まで、全てレジスタ上で行う */
+		const typename SimdVecTraits_t::IntrinsicType_t aColumn[4] = {
+			m.columns[0].simdVec, m.columns[1].simdVec, m.columns[2].simdVec, m.columns[3].simdVec
+		};
+		typename SimdVecTraits_t::IntrinsicType_t aResult[4];
+		rDeterminant = SimdVecTraits_t::ExtractFirst(SimdVecTraits_t::Inverse4x4(aColumn, aResult));
+		GenMat<Element_t, 4, 4> result;
+		result.columns[0].simdVec = aResult[0];
+		result.columns[1].simdVec = aResult[1];
+		result.columns[2].simdVec = aResult[2];
+		result.columns[3].simdVec = aResult[3];
+		return result;
+	}
 /* @@ 要サニタイズ */
 	typedef Element_t T;
 	T Coef00 = m.columns[2].elements[2] * m.columns[3].elements[3] - m.columns[3].elements[2] * m.columns[2].elements[3];
@@ -2845,8 +5996,702 @@ static inline GenMat<Element_t, 4, 4> inverse(
 
 	T OneOverDeterminant = static_cast<T>(1) / Dot1;
 
+	rDeterminant = Dot1;
 	return Inverse * OneOverDeterminant;
 }
+template<typename Element_t, int memDimC, int memDimR, int recursiveCount>
+static inline GenMat<Element_t, 4, 4> inverse(
+	const Mat<Element_t, 4, memDimC, 4, memDimR, recursiveCount> &rParam
+){
+	Element_t det;
+	return inverse(rParam, det);
+}
+
+
+/*=============================================================================
+▼	アフィン変換
+-----------------------------------------------------------------------------*/
+/*
+	4x3 行列を、列 0 1 2 を線形部分 L、列 3 を平行移動 t とするアフィン変換として扱う。
+	4x4 行列の最下行が (0, 0, 0, 1) に固定されたものと同じ意味を持つ。
+	列が 4 成分分のメモリを持つ行列（mat4x3a dmat4x3a）では、全てレジスタ上で計算する。
+*/
+template<typename Element_t, int memDimC, int memDimR, int recursiveCount>
+struct AffineSimdPath {
+	using SimdVecTraits_t = GenSimdVecTraits<Element_t, memDimR>;
+	enum {
+		/* 列を SIMD 型のまま読み込めるか？ */
+		isEnabled = SimdVecTraits_t::isSimd && memDimR == 4,
+
+		/* 結果の列のメモリ次元数 */
+		tempMemDimR = MatTraits<4, memDimC, 3, memDimR, recursiveCount>::tempMemDimR,
+	};
+
+	/* 列の読み込み */
+	static inline void LoadColumns(
+		const Mat<Element_t, 4, memDimC, 3, memDimR, recursiveCount> &rParam,
+		typename SimdVecTraits_t::IntrinsicType_t aColumn[4]
+	){
+		aColumn[0] = rParam.columns[0].simdVec;
+		aColumn[1] = rParam.columns[1].simdVec;
+		aColumn[2] = rParam.columns[2].simdVec;
+		aColumn[3] = rParam.columns[3].simdVec;
+	}
+
+	/* 列の書き込み */
+	static inline void StoreColumns(
+		GenMat2<Element_t, 4, 3, tempMemDimR> &rResult,
+		const typename SimdVecTraits_t::IntrinsicType_t aColumn[4]
+	){
+		for (int i = 0; i < 4; ++i) {
+			if constexpr (tempMemDimR == 4) {
+				rResult.columns[i].simdVec = aColumn[i];
+			} else {
+				SimdVecTraits_t::template StorePartial<3>(rResult.columns[i].elements, aColumn[i]);
+			}
+		}
+	}
+};
+
+/* 点の変換（L * p + t）*/
+template<typename Element_t, int memDimC, int memDimR, int recursiveCount, int memDim, int swizzle, int recursiveCountV>
+static inline GenVec2<Element_t, 3, Traits<3, memDim, swizzle>::tempMemDim> transformPoint(
+	const Mat<Element_t, 4, memDimC, 3, memDimR, recursiveCount> &rMat,
+	const Vec<Element_t, Traits<3, memDim, swizzle>, recursiveCountV> &rVec
+){
+	using TraitsV_t = Traits<3, memDim, swizzle>;
+	using AffineSimdPath_t = AffineSimdPath<Element_t, memDimC, memDimR, recursiveCount>;
+	static_assert(TraitsV_t::isValid);
+	GenVec2<Element_t, 3, TraitsV_t::tempMemDim> result;
+	if constexpr (AffineSimdPath_t::isEnabled && memDim == 4 && SimdPath<Element_t, TraitsV_t>::isReadable) {
+		using SimdVecTraits_t = typename AffineSimdPath_t::SimdVecTraits_t;
+		typename SimdVecTraits_t::IntrinsicType_t aColumn[4];
+		AffineSimdPath_t::LoadColumns(rMat, aColumn);
+		const auto simdVec = SimdVecTraits_t::template TransformAffine<1>(aColumn, rVec.GetSimdVec());
+		if constexpr (TraitsV_t::tempMemDim == 4) {
+			result.simdVec = simdVec;
+		} else {
+			SimdVecTraits_t::template StorePartial<3>(result.elements, simdVec);
+		}
+		return result;
+	}
+	for (int i = 0; i < 3; ++i) {
+		result.elements[i] =
+			rMat.columns[0].elements[i] * rVec.elements[TraitsV_t::i0]
+		+	rMat.columns[1].elements[i] * rVec.elements[TraitsV_t::i1]
+		+	rMat.columns[2].elements[i] * rVec.elements[TraitsV_t::i2]
+		+	rMat.columns[3].elements[i];
+	}
+	return result;
+}
+
+/* 方向ベクトルの変換（L * v。平行移動は適用しない）*/
+template<typename Element_t, int memDimC, int memDimR, int recursiveCount, int memDim, int swizzle, int recursiveCountV>
+static inline GenVec2<Element_t, 3, Traits<3, memDim, swizzle>::tempMemDim> transformVector(
+	const Mat<Element_t, 4, memDimC, 3, memDimR, recursiveCount> &rMat,
+	const Vec<Element_t, Traits<3, memDim, swizzle>, recursiveCountV> &rVec
+){
+	using TraitsV_t = Traits<3, memDim, swizzle>;
+	using AffineSimdPath_t = AffineSimdPath<Element_t, memDimC, memDimR, recursiveCount>;
+	static_assert(TraitsV_t::isValid);
+	GenVec2<Element_t, 3, TraitsV_t::tempMemDim> result;
+	if constexpr (AffineSimdPath_t::isEnabled && memDim == 4 && SimdPath<Element_t, TraitsV_t>::isReadable) {
+		using SimdVecTraits_t = typename AffineSimdPath_t::SimdVecTraits_t;
+		typename SimdVecTraits_t::IntrinsicType_t aColumn[4];
+		AffineSimdPath_t::LoadColumns(rMat, aColumn);
+		const auto simdVec = SimdVecTraits_t::template TransformAffine<0>(aColumn, rVec.GetSimdVec());
+		if constexpr (TraitsV_t::tempMemDim == 4) {
+			result.simdVec = simdVec;
+		} else {
+			SimdVecTraits_t::template StorePartial<3>(result.elements, simdVec);
+		}
+		return result;
+	}
+	for (int i = 0; i < 3; ++i) {
+		result.elements[i] =
+			rMat.columns[0].elements[i] * rVec.elements[TraitsV_t::i0]
+		+	rMat.columns[1].elements[i] * rVec.elements[TraitsV_t::i1]
+		+	rMat.columns[2].elements[i] * rVec.elements[TraitsV_t::i2];
+	}
+	return result;
+}
+
+/*
+	アフィン変換の合成（rParam0 * rParam1。rParam1 を適用してから rParam0 を適用する変換）
+	4x4 行列の積と異なり、最下行 (0, 0, 0, 1) との積を省く。
+*/
+template<typename Element_t, int memDimC0, int memDimR0, int recursiveCount0, int memDimC1, int memDimR1, int recursiveCount1>
+static inline GenMat2<Element_t, 4, 3, AffineSimdPath<Element_t, memDimC0, memDimR0, recursiveCount0>::tempMemDimR> composeAffine(
+	const Mat<Element_t, 4, memDimC0, 3, memDimR0, recursiveCount0> &rParam0,
+	const Mat<Element_t, 4, memDimC1, 3, memDimR1, recursiveCount1> &rParam1
+){
+	using AffineSimdPath0_t = AffineSimdPath<Element_t, memDimC0, memDimR0, recursiveCount0>;
+	using AffineSimdPath1_t = AffineSimdPath<Element_t, memDimC1, memDimR1, recursiveCount1>;
+	GenMat2<Element_t, 4, 3, AffineSimdPath0_t::tempMemDimR> result;
+	if constexpr (AffineSimdPath0_t::isEnabled && AffineSimdPath1_t::isEnabled) {
+		using SimdVecTraits_t = typename AffineSimdPath0_t::SimdVecTraits_t;
+		typename SimdVecTraits_t::IntrinsicType_t aColumn0[4], aColumn1[4], aResult[4];
+		AffineSimdPath0_t::LoadColumns(rParam0, aColumn0);
+		AffineSimdPath1_t::LoadColumns(rParam1, aColumn1);
+		SimdVecTraits_t::ComposeAffine(aColumn0, aColumn1, aResult);
+		AffineSimdPath0_t::StoreColumns(result, aResult);
+		return result;
+	}
+	for (int j = 0; j < 4; ++j) {
+		for (int i = 0; i < 3; ++i) {
+			Element_t tmp =
+				rParam0.columns[0].elements[i] * rParam1.columns[j].elements[0]
+			+	rParam0.columns[1].elements[i] * rParam1.columns[j].elements[1]
+			+	rParam0.columns[2].elements[i] * rParam1.columns[j].elements[2];
+			if (j == 3) { tmp += rParam0.columns[3].elements[i]; }
+			result.columns[j].elements[i] = tmp;
+		}
+	}
+	return result;
+}
+
+/*
+	アフィン変換の逆変換（線形部分の行列式も同時に求める）
+	線形部分 L の逆行列を求め、平行移動を -inverse(L) * t とする。4x4 の逆行列より大幅に軽い。
+	行列式が 0 の場合、戻り値の成分は inf または nan になる。呼び出し側で rDeterminant を調べて破棄すること。
+*/
+template<typename Element_t, int memDimC, int memDimR, int recursiveCount>
+static inline GenMat2<Element_t, 4, 3, AffineSimdPath<Element_t, memDimC, memDimR, recursiveCount>::tempMemDimR> inverseAffine(
+	const Mat<Element_t, 4, memDimC, 3, memDimR, recursiveCount> &rParam,
+	Element_t &rDeterminant
+){
+	using AffineSimdPath_t = AffineSimdPath<Element_t, memDimC, memDimR, recursiveCount>;
+	GenMat2<Element_t, 4, 3, AffineSimdPath_t::tempMemDimR> result;
+	if constexpr (AffineSimdPath_t::isEnabled) {
+		using SimdVecTraits_t = typename AffineSimdPath_t::SimdVecTraits_t;
+		typename SimdVecTraits_t::IntrinsicType_t aColumn[4], aResult[4];
+		AffineSimdPath_t::LoadColumns(rParam, aColumn);
+		rDeterminant = SimdVecTraits_t::ExtractFirst(SimdVecTraits_t::InverseAffine(aColumn, aResult));
+		AffineSimdPath_t::StoreColumns(result, aResult);
+		return result;
+	}
+	GenMat<Element_t, 3, 3> linear;
+	for (int j = 0; j < 3; ++j) {
+		for (int i = 0; i < 3; ++i) { linear.columns[j].elements[i] = rParam.columns[j].elements[i]; }
+	}
+	rDeterminant = determinant(linear);
+	const GenMat<Element_t, 3, 3> invLinear = inverse(linear);
+	for (int j = 0; j < 3; ++j) {
+		for (int i = 0; i < 3; ++i) { result.columns[j].elements[i] = invLinear.columns[j].elements[i]; }
+	}
+	for (int i = 0; i < 3; ++i) {
+		result.columns[3].elements[i] = -(
+			invLinear.columns[0].elements[i] * rParam.columns[3].elements[0]
+		+	invLinear.columns[1].elements[i] * rParam.columns[3].elements[1]
+		+	invLinear.columns[2].elements[i] * rParam.columns[3].elements[2]
+		);
+	}
+	return result;
+}
+template<typename Element_t, int memDimC, int memDimR, int recursiveCount>
+static inline GenMat2<Element_t, 4, 3, AffineSimdPath<Element_t, memDimC, memDimR, recursiveCount>::tempMemDimR> inverseAffine(
+	const Mat<Element_t, 4, memDimC, 3, memDimR, recursiveCount> &rParam
+){
+	Element_t det;
+	return inverseAffine(rParam, det);
+}
+
+/*
+	線形部分が正規直交（回転のみ、または回転と鏡映）であるアフィン変換の逆変換
+	線形部分を転置し、平行移動を -transpose(L) * t とする。スケールを含む変換に使ってはならない。
+*/
+template<typename Element_t, int memDimC, int memDimR, int recursiveCount>
+static inline GenMat2<Element_t, 4, 3, AffineSimdPath<Element_t, memDimC, memDimR, recursiveCount>::tempMemDimR> inverseAffineOrthonormal(
+	const Mat<Element_t, 4, memDimC, 3, memDimR, recursiveCount> &rParam
+){
+	using AffineSimdPath_t = AffineSimdPath<Element_t, memDimC, memDimR, recursiveCount>;
+	GenMat2<Element_t, 4, 3, AffineSimdPath_t::tempMemDimR> result;
+	if constexpr (AffineSimdPath_t::isEnabled) {
+		using SimdVecTraits_t = typename AffineSimdPath_t::SimdVecTraits_t;
+		typename SimdVecTraits_t::IntrinsicType_t aColumn[4], aResult[4];
+		AffineSimdPath_t::LoadColumns(rParam, aColumn);
+		SimdVecTraits_t::InverseAffineOrthonormal(aColumn, aResult);
+		AffineSimdPath_t::StoreColumns(result, aResult);
+		return result;
+	}
+	for (int j = 0; j < 3; ++j) {
+		for (int i = 0; i < 3; ++i) { result.columns[j].elements[i] = rParam.columns[i].elements[j]; }
+		result.columns[3].elements[j] = -(
+			rParam.columns[j].elements[0] * rParam.columns[3].elements[0]
+		+	rParam.columns[j].elements[1] * rParam.columns[3].elements[1]
+		+	rParam.columns[j].elements[2] * rParam.columns[3].elements[2]
+		);
+	}
+	return result;
+}
+
+
+/*=============================================================================
+▼	構造付き行列
+-----------------------------------------------------------------------------*/
+/*
+	成分の配置が既知の dim x dim 行列。必要な成分のみを保持し、積 逆行列 転置を
+	構造に応じた専用の計算で行う。密な行列が必要な場合は ToMat() で GenMat に昇格する。
+	構造付き行列どうしの積は、結果が同じ構造に収まる場合のみ構造付き行列を返し、
+	それ以外は GenMat を返す。
+*/
+struct MatStructure {
+	enum {
+		/* 対角行列（スケール）*/
+		diagonal,
+
+		/* 平行移動（同次座標の行列。最終列の先頭 dim - 1 成分のみが単位行列と異なる）*/
+		translation,
+
+		/* 座標軸回りの回転（先頭 3 成分に作用する。それ以外の成分は単位行列と同じ）*/
+		rotationX,
+		rotationY,
+		rotationZ,
+
+		/* 正規直交行列（回転、または回転と鏡映）*/
+		orthonormal,
+	};
+
+	/* 正規直交な構造か？ */
+	static constexpr bool IsOrthonormal(int structure){
+		return structure == rotationX || structure == rotationY || structure == rotationZ || structure == orthonormal;
+	}
+};
+
+template<typename Element_t, int dim, int structure>
+struct StructuredMat;
+
+/* 対角行列 */
+template<typename Element_t, int dim>
+struct StructuredMat<Element_t, dim, MatStructure::diagonal> {
+	/* 対角成分 */
+	GenVec<Element_t, dim> diagonal;
+
+	/* コンストラクタ */
+	StructuredMat() = default;
+	template<typename Traits_t, int recursiveCount>
+	inline explicit StructuredMat(const Vec<Element_t, Traits_t, recursiveCount> &rDiagonal) : diagonal(rDiagonal) {}
+	inline explicit StructuredMat(Element_t scale) : diagonal(scale) {}
+
+	/* 密な行列に昇格 */
+	inline GenMat<Element_t, dim, dim> ToMat() const {
+		GenMat<Element_t, dim, dim> result(Element_t(0));
+		for (int i = 0; i < dim; ++i) { result.columns[i].elements[i] = diagonal.elements[i]; }
+		return result;
+	}
+};
+
+/* 平行移動 */
+template<typename Element_t, int dim>
+struct StructuredMat<Element_t, dim, MatStructure::translation> {
+	static_assert(dim >= 2);
+
+	/* 平行移動量 */
+	GenVec<Element_t, dim - 1> translation;
+
+	/* コンストラクタ */
+	StructuredMat() = default;
+	template<typename Traits_t, int recursiveCount>
+	inline explicit StructuredMat(const Vec<Element_t, Traits_t, recursiveCount> &rTranslation) : translation(rTranslation) {}
+
+	/* 密な行列に昇格 */
+	inline GenMat<Element_t, dim, dim> ToMat() const {
+		GenMat<Element_t, dim, dim> result(Element_t(0));
+		for (int i = 0; i < dim; ++i) { result.columns[i].elements[i] = Element_t(1); }
+		for (int i = 0; i < dim - 1; ++i) { result.columns[dim - 1].elements[i] = translation.elements[i]; }
+		return result;
+	}
+};
+
+/*
+	座標軸回りの回転
+	回転面を張る 2 軸を i j（x 軸回りなら y z、y 軸回りなら z x、z 軸回りなら x y）として、
+	列 i を (cos, sin)、列 j を (-sin, cos) とする右手系の回転。
+*/
+template<typename Element_t, int dim, int structure>
+struct StructuredMat {
+	static_assert(structure == MatStructure::rotationX || structure == MatStructure::rotationY || structure == MatStructure::rotationZ);
+	static_assert(dim >= 3);
+	enum {
+		/* 回転面を張る軸 */
+		axisI = (structure - MatStructure::rotationX + 1) % 3,
+		axisJ = (structure - MatStructure::rotationX + 2) % 3,
+	};
+
+	/* 回転角の余弦と正弦 */
+	Element_t cosTheta;
+	Element_t sinTheta;
+
+	/* コンストラクタ */
+	StructuredMat() = default;
+	inline explicit StructuredMat(Element_t angle) : cosTheta(std::cos(angle)), sinTheta(std::sin(angle)) {}
+	inline StructuredMat(Element_t cosTheta_, Element_t sinTheta_) : cosTheta(cosTheta_), sinTheta(sinTheta_) {}
+
+	/* 密な行列に昇格 */
+	inline GenMat<Element_t, dim, dim> ToMat() const {
+		GenMat<Element_t, dim, dim> result(Element_t(0));
+		for (int i = 0; i < dim; ++i) { result.columns[i].elements[i] = Element_t(1); }
+		result.columns[axisI].elements[axisI] =  cosTheta;
+		result.columns[axisI].elements[axisJ] =  sinTheta;
+		result.columns[axisJ].elements[axisI] = -sinTheta;
+		result.columns[axisJ].elements[axisJ] =  cosTheta;
+		return result;
+	}
+};
+
+/* 正規直交行列（逆行列を転置で求める）*/
+template<typename Element_t, int dim>
+struct StructuredMat<Element_t, dim, MatStructure::orthonormal> {
+	/* 行列本体 */
+	GenMat<Element_t, dim, dim> matrix;
+
+	/* コンストラクタ（rMatrix が正規直交であることは呼び出し側が保証する）*/
+	StructuredMat() = default;
+	template<int memDimC, int memDimR, int recursiveCount>
+	inline explicit StructuredMat(const Mat<Element_t, dim, memDimC, dim, memDimR, recursiveCount> &rMatrix){
+		for (int i = 0; i < dim; ++i) { matrix.columns[i] = rMatrix.columns[i]; }
+	}
+	template<int structure>
+	inline explicit StructuredMat(const StructuredMat<Element_t, dim, structure> &rParam) : matrix(rParam.ToMat()) {
+		static_assert(MatStructure::IsOrthonormal(structure));
+	}
+
+	/* 密な行列に昇格 */
+	inline GenMat<Element_t, dim, dim> ToMat() const { return matrix; }
+};
+
+/* 構造付き行列とベクトルの積 */
+template<typename Element_t, int dim, int structure, int memDim, int swizzle, int recursiveCount>
+static inline GenVec2<Element_t, dim, Traits<dim, memDim, swizzle>::tempMemDim> operator*(
+	const StructuredMat<Element_t, dim, structure> &rMat,
+	const Vec<Element_t, Traits<dim, memDim, swizzle>, recursiveCount> &rVec
+){
+	GenVec2<Element_t, dim, Traits<dim, memDim, swizzle>::tempMemDim> result;
+	if constexpr (structure == MatStructure::diagonal) {
+		result = rVec * rMat.diagonal;
+	} else if constexpr (structure == MatStructure::translation) {
+		result = rVec;
+		const Element_t w = result.elements[dim - 1];
+		for (int i = 0; i < dim - 1; ++i) { result.elements[i] += rMat.translation.elements[i] * w; }
+	} else if constexpr (structure == MatStructure::orthonormal) {
+		result = rMat.matrix * rVec;
+	} else {
+		using Mat_t = StructuredMat<Element_t, dim, structure>;
+		result = rVec;
+		const Element_t vi = result.elements[Mat_t::axisI];
+		const Element_t vj = result.elements[Mat_t::axisJ];
+		result.elements[Mat_t::axisI] = rMat.cosTheta * vi - rMat.sinTheta * vj;
+		result.elements[Mat_t::axisJ] = rMat.sinTheta * vi + rMat.cosTheta * vj;
+	}
+	return result;
+}
+
+/* 構造付き行列と行列の積（構造付き行列が左）*/
+template<typename Element_t, int dim, int structure, int memDimC, int memDimR, int recursiveCount>
+static inline GenMat2<Element_t, dim, dim, MatTraits<dim, memDimC, dim, memDimR, recursiveCount>::tempMemDimR> operator*(
+	const StructuredMat<Element_t, dim, structure> &rParam0,
+	const Mat<Element_t, dim, memDimC, dim, memDimR, recursiveCount> &rParam1
+){
+	GenMat2<Element_t, dim, dim, MatTraits<dim, memDimC, dim, memDimR, recursiveCount>::tempMemDimR> result;
+	if constexpr (structure == MatStructure::orthonormal) {
+		result = rParam0.matrix * rParam1;
+	} else {
+		/* 各列に構造付き行列を作用させる */
+		for (int i = 0; i < dim; ++i) { result.columns[i] = rParam0 * rParam1.columns[i]; }
+	}
+	return result;
+}
+
+/* 行列と構造付き行列の積（構造付き行列が右）*/
+template<typename Element_t, int dim, int structure, int memDimC, int memDimR, int recursiveCount>
+static inline GenMat2<Element_t, dim, dim, MatTraits<dim, memDimC, dim, memDimR, recursiveCount>::tempMemDimR> operator*(
+	const Mat<Element_t, dim, memDimC, dim, memDimR, recursiveCount> &rParam0,
+	const StructuredMat<Element_t, dim, structure> &rParam1
+){
+	GenMat2<Element_t, dim, dim, MatTraits<dim, memDimC, dim, memDimR, recursiveCount>::tempMemDimR> result;
+	if constexpr (structure == MatStructure::diagonal) {
+		/* 列 i を対角成分 i 倍する */
+		for (int i = 0; i < dim; ++i) { result.columns[i] = rParam0.columns[i] * rParam1.diagonal.elements[i]; }
+	} else if constexpr (structure == MatStructure::translation) {
+		/* 最終列のみが変わる */
+		for (int i = 0; i < dim - 1; ++i) { result.columns[i] = rParam0.columns[i]; }
+		result.columns[dim - 1] = rParam0.columns[dim - 1];
+		for (int i = 0; i < dim - 1; ++i) { result.columns[dim - 1] += rParam0.columns[i] * rParam1.translation.elements[i]; }
+	} else if constexpr (structure == MatStructure::orthonormal) {
+		result = rParam0 * rParam1.matrix;
+	} else {
+		/* 回転面を張る 2 列のみが変わる */
+		using Mat_t = StructuredMat<Element_t, dim, structure>;
+		for (int i = 0; i < dim; ++i) { result.columns[i] = rParam0.columns[i]; }
+		result.columns[Mat_t::axisI] = rParam0.columns[Mat_t::axisI] * rParam1.cosTheta + rParam0.columns[Mat_t::axisJ] * rParam1.sinTheta;
+		result.columns[Mat_t::axisJ] = rParam0.columns[Mat_t::axisJ] * rParam1.cosTheta - rParam0.columns[Mat_t::axisI] * rParam1.sinTheta;
+	}
+	return result;
+}
+
+/*
+	構造付き行列どうしの積
+	同じ構造（回転は同じ軸）なら同じ構造、正規直交どうしなら正規直交行列、それ以外は GenMat を返す。
+*/
+template<typename Element_t, int dim, int structure0, int structure1>
+static inline auto operator*(
+	const StructuredMat<Element_t, dim, structure0> &rParam0,
+	const StructuredMat<Element_t, dim, structure1> &rParam1
+){
+	if constexpr (structure0 == MatStructure::diagonal && structure1 == MatStructure::diagonal) {
+		return StructuredMat<Element_t, dim, MatStructure::diagonal>(rParam0.diagonal * rParam1.diagonal);
+	} else if constexpr (structure0 == MatStructure::translation && structure1 == MatStructure::translation) {
+		return StructuredMat<Element_t, dim, MatStructure::translation>(rParam0.translation + rParam1.translation);
+	} else if constexpr (structure0 == structure1 && structure0 != MatStructure::orthonormal) {
+		/* 同じ軸回りの回転は角度の和（加法定理）*/
+		return StructuredMat<Element_t, dim, structure0>(
+			rParam0.cosTheta * rParam1.cosTheta - rParam0.sinTheta * rParam1.sinTheta,
+			rParam0.sinTheta * rParam1.cosTheta + rParam0.cosTheta * rParam1.sinTheta
+		);
+	} else if constexpr (MatStructure::IsOrthonormal(structure0) && MatStructure::IsOrthonormal(structure1)) {
+		StructuredMat<Element_t, dim, MatStructure::orthonormal> result;
+		if constexpr (structure1 == MatStructure::orthonormal) {
+			result.matrix = rParam0 * rParam1.matrix;
+		} else {
+			result.matrix = rParam0.ToMat() * rParam1;
+		}
+		return result;
+	} else {
+		/* 右側の構造を活かして密な行列との積を取る */
+		return GenMat<Element_t, dim, dim>(rParam0.ToMat() * rParam1);
+	}
+}
+
+/* 構造付き行列の逆行列 */
+template<typename Element_t, int dim, int structure>
+static inline StructuredMat<Element_t, dim, structure> inverse(
+	const StructuredMat<Element_t, dim, structure> &rParam
+){
+	if constexpr (structure == MatStructure::diagonal) {
+		return StructuredMat<Element_t, dim, structure>(Element_t(1) / rParam.diagonal);
+	} else if constexpr (structure == MatStructure::translation) {
+		return StructuredMat<Element_t, dim, structure>(-rParam.translation);
+	} else if constexpr (structure == MatStructure::orthonormal) {
+		StructuredMat<Element_t, dim, structure> result;
+		result.matrix = transpose(rParam.matrix);
+		return result;
+	} else {
+		return StructuredMat<Element_t, dim, structure>(rParam.cosTheta, -rParam.sinTheta);
+	}
+}
+
+/* 構造付き行列の転置（平行移動は転置すると構造が崩れるので GenMat を返す）*/
+template<typename Element_t, int dim, int structure>
+static inline auto transpose(
+	const StructuredMat<Element_t, dim, structure> &rParam
+){
+	if constexpr (structure == MatStructure::diagonal) {
+		return rParam;
+	} else if constexpr (structure == MatStructure::translation) {
+		return GenMat<Element_t, dim, dim>(transpose(rParam.ToMat()));
+	} else {
+		return inverse(rParam);
+	}
+}
+
+/* 構造付き行列の行列式 */
+template<typename Element_t, int dim, int structure>
+static inline Element_t determinant(
+	const StructuredMat<Element_t, dim, structure> &rParam
+){
+	if constexpr (structure == MatStructure::diagonal) {
+		Element_t result = rParam.diagonal.elements[0];
+		for (int i = 1; i < dim; ++i) { result *= rParam.diagonal.elements[i]; }
+		return result;
+	} else if constexpr (structure == MatStructure::orthonormal) {
+		/* 鏡映を含む場合は -1 */
+		return determinant(rParam.matrix);
+	} else {
+		return Element_t(1);
+	}
+}
+
+
+/*=============================================================================
+▼	行優先の行列
+-----------------------------------------------------------------------------*/
+/*
+	GLSL の layout(row_major) に相当する、行を単位に格納する opeDimC 列 opeDimR 行の行列。
+	演算の意味は Mat と同じで、格納順のみが異なる。行を memDimC 成分のメモリを持つベクトルとして
+	隙間なく並べるので、行優先の配列（物理エンジンやアセットの 3x4 行列など）とそのまま共有できる。
+	Mat との変換は明示的に行う（ToMat() とコンストラクタ）。
+	行優先の M の行は転置 transpose(M) の列と同じ並びなので、転置は並べ替えを伴わない。
+*/
+template<typename Element_t, int opeDimC, int opeDimR, int memDimC>
+struct RowMajorMat {
+	static_assert(opeDimC >= 1 && opeDimC <= 4 && opeDimR >= 1 && opeDimR <= 4 && opeDimC <= memDimC);
+
+	/* 行の型 */
+	using Row_t = GenVec2<Element_t, opeDimC, memDimC>;
+
+	/* 行 */
+	Row_t rows[opeDimR];
+
+	/* コンストラクタ */
+	RowMajorMat() = default;
+	inline explicit RowMajorMat(Element_t param){
+		for (int i = 0; i < opeDimR; ++i) { rows[i] = Row_t(param); }
+	}
+
+	/* 列優先の行列からの変換（並べ替えを伴う）*/
+	template<int memDimC1, int memDimR1, int recursiveCount1>
+	inline explicit RowMajorMat(const Mat<Element_t, opeDimC, memDimC1, opeDimR, memDimR1, recursiveCount1> &rParam){
+		const auto tmp = transpose(rParam);
+		for (int i = 0; i < opeDimR; ++i) { rows[i] = tmp.columns[i]; }
+	}
+
+	/* 列優先の行列への変換（並べ替えを伴う）*/
+	inline GenMat<Element_t, opeDimC, opeDimR> ToMat() const {
+		GenMat<Element_t, opeDimC, opeDimR> result;
+		const auto tmp = transpose(transpose(*this));
+		for (int i = 0; i < opeDimC; ++i) { result.columns[i] = tmp.columns[i]; }
+		return result;
+	}
+
+	/* 列の取り出し */
+	inline GenVec<Element_t, opeDimR> GetColumn(int i) const {
+		GenVec<Element_t, opeDimR> result;
+		for (int j = 0; j < opeDimR; ++j) { result.elements[j] = rows[j].elements[i]; }
+		return result;
+	}
+
+	/* 加減算 */
+	inline RowMajorMat operator+(const RowMajorMat &rParam) const {
+		RowMajorMat result;
+		for (int i = 0; i < opeDimR; ++i) { result.rows[i] = rows[i] + rParam.rows[i]; }
+		return result;
+	}
+	inline RowMajorMat operator-(const RowMajorMat &rParam) const {
+		RowMajorMat result;
+		for (int i = 0; i < opeDimR; ++i) { result.rows[i] = rows[i] - rParam.rows[i]; }
+		return result;
+	}
+	inline RowMajorMat operator-() const {
+		RowMajorMat result;
+		for (int i = 0; i < opeDimR; ++i) { result.rows[i] = -rows[i]; }
+		return result;
+	}
+
+	/* スカラとの乗算 */
+	inline RowMajorMat operator*(Element_t param) const {
+		RowMajorMat result;
+		for (int i = 0; i < opeDimR; ++i) { result.rows[i] = rows[i] * param; }
+		return result;
+	}
+};
+
+/* スカラとの乗算（第一引数がスカラの場合）*/
+template<typename Element_t, int opeDimC, int opeDimR, int memDimC>
+static inline RowMajorMat<Element_t, opeDimC, opeDimR, memDimC> operator*(
+	Element_t param,
+	const RowMajorMat<Element_t, opeDimC, opeDimR, memDimC> &rMat
+){
+	return rMat * param;
+}
+
+/*
+	行優先の行列とベクトルの積
+	結果の成分 i は行 i とベクトルの内積。4 成分の行は、行ごとの積を 4x4 転置して足し合わせ、
+	全ての内積を 1 本のレジスタに並べる。
+*/
+template<typename Element_t, int opeDimC, int opeDimR, int memDimC, int memDim, int swizzle, int recursiveCount>
+static inline GenVec<Element_t, opeDimR> operator*(
+	const RowMajorMat<Element_t, opeDimC, opeDimR, memDimC> &rMat,
+	const Vec<Element_t, Traits<opeDimC, memDim, swizzle>, recursiveCount> &rVec
+){
+	using Traits1_t = Traits<opeDimC, memDim, swizzle>;
+	using SimdVecTraits_t = GenSimdVecTraits<Element_t, 4>;
+	static_assert(Traits1_t::isValid);
+	GenVec<Element_t, opeDimR> result;
+	if constexpr (
+		std::is_floating_point_v<Element_t>
+	&&	SimdVecTraits_t::isSimd
+	&&	memDimC == 4
+	&&	memDim == 4
+	&&	SimdPath<Element_t, Traits1_t>::isReadable
+	) {
+		typename SimdVecTraits_t::IntrinsicType_t aRow[opeDimR];
+		for (int i = 0; i < opeDimR; ++i) { aRow[i] = rMat.rows[i].simdVec; }
+		const auto simdVec = SimdVecTraits_t::template DotColumns<opeDimC, opeDimR>(rVec.GetSimdVec(), aRow);
+		if constexpr (opeDimR == 4) {
+			result.simdVec = simdVec;
+		} else {
+			SimdVecTraits_t::template StorePartial<opeDimR>(result.elements, simdVec);
+		}
+		return result;
+	}
+	for (int i = 0; i < opeDimR; ++i) {
+		Element_t tmp = rMat.rows[i].elements[0] * rVec.elements[Traits1_t::i0];
+		if constexpr (opeDimC >= 2) { tmp += rMat.rows[i].elements[1] * rVec.elements[Traits1_t::i1]; }
+		if constexpr (opeDimC >= 3) { tmp += rMat.rows[i].elements[2] * rVec.elements[Traits1_t::i2]; }
+		if constexpr (opeDimC >= 4) { tmp += rMat.rows[i].elements[3] * rVec.elements[Traits1_t::i3]; }
+		result.elements[i] = tmp;
+	}
+	return result;
+}
+
+/* ベクトルと行優先の行列の積（行の線形結合）*/
+template<typename Element_t, int opeDimC, int opeDimR, int memDimC, int memDim, int swizzle, int recursiveCount>
+static inline GenVec2<Element_t, opeDimC, memDimC> operator*(
+	const Vec<Element_t, Traits<opeDimR, memDim, swizzle>, recursiveCount> &rVec,
+	const RowMajorMat<Element_t, opeDimC, opeDimR, memDimC> &rMat
+){
+	using Traits0_t = Traits<opeDimR, memDim, swizzle>;
+	static_assert(Traits0_t::isValid);
+	GenVec2<Element_t, opeDimC, memDimC> result = rMat.rows[0] * rVec.elements[Traits0_t::i0];
+	if constexpr (opeDimR >= 2) { result += rMat.rows[1] * rVec.elements[Traits0_t::i1]; }
+	if constexpr (opeDimR >= 3) { result += rMat.rows[2] * rVec.elements[Traits0_t::i2]; }
+	if constexpr (opeDimR >= 4) { result += rMat.rows[3] * rVec.elements[Traits0_t::i3]; }
+	return result;
+}
+
+/*
+	行優先の行列どうしの積
+	結果の行 i は、右辺の行を左辺の行 i の成分で線形結合したもの。
+*/
+template<typename Element_t, int opeDimK, int opeDimR, int memDimC0, int opeDimC, int memDimC1>
+static inline RowMajorMat<Element_t, opeDimC, opeDimR, memDimC1> operator*(
+	const RowMajorMat<Element_t, opeDimK, opeDimR, memDimC0> &rParam0,
+	const RowMajorMat<Element_t, opeDimC, opeDimK, memDimC1> &rParam1
+){
+	RowMajorMat<Element_t, opeDimC, opeDimR, memDimC1> result;
+	for (int i = 0; i < opeDimR; ++i) { result.rows[i] = rParam0.rows[i] * rParam1; }
+	return result;
+}
+
+/* 転置（行優先の行の並びをそのまま列として持つ列優先の行列を返す）*/
+template<typename Element_t, int opeDimC, int opeDimR, int memDimC>
+static inline GenMat2<Element_t, opeDimR, opeDimC, memDimC> transpose(
+	const RowMajorMat<Element_t, opeDimC, opeDimR, memDimC> &rParam
+){
+	GenMat2<Element_t, opeDimR, opeDimC, memDimC> result;
+	for (int i = 0; i < opeDimR; ++i) { result.columns[i] = rParam.rows[i]; }
+	return result;
+}
+
+/* 行列式（転置しても変わらない）*/
+template<typename Element_t, int dim, int memDimC>
+static inline Element_t determinant(
+	const RowMajorMat<Element_t, dim, dim, memDimC> &rParam
+){
+	return determinant(transpose(rParam));
+}
+
+/* 逆行列（inverse(transpose(M)) の列は inverse(M) の行なので、並べ替えずに行として格納する）*/
+template<typename Element_t, int dim, int memDimC>
+static inline RowMajorMat<Element_t, dim, dim, memDimC> inverse(
+	const RowMajorMat<Element_t, dim, dim, memDimC> &rParam
+){
+	const auto tmp = inverse(transpose(rParam));
+	RowMajorMat<Element_t, dim, dim, memDimC> result;
+	for (int i = 0; i < dim; ++i) { result.rows[i] = tmp.columns[i]; }
+	return result;
+}
 
 
 /*
@@ -2869,6 +6714,14 @@ using dvec3 = GenVec<double, 3>;
 using dvec2 = GenVec<double, 2>;
 using dvec1 = GenVec<double, 1>;
 
+/*
+	4 成分分のメモリを持つ 3 次元ベクトル（w 成分はパディング）
+	SIMD 演算の対象となる。配列などメモリ効率が重要な箇所では vec3 / dvec3 と相互に変換して用いる（配列の変換は toPadded toPacked）。
+	演算結果のパディング成分は 0 に保つ（SimdPath::keepsZeroPadding を参照）。
+*/
+using vec3a = GenVec2<float, 3, 4>;
+using dvec3a = GenVec2<double, 3, 4>;
+
 using ivec4 = GenIvec<int, 4>;
 using ivec3 = GenIvec<int, 3>;
 using ivec2 = GenIvec<int, 2>;
@@ -2884,6 +6737,13 @@ using bvec3 = GenBvec<bool, 3>;
 using bvec2 = GenBvec<bool, 2>;
 using bvec1 = GenBvec<bool, 1>;
 
+/*
+	レーンマスク形式の bvec（各成分は全ビット 1 または 0）
+	4 成分の float / int / uint ベクトルの比較関数はこの型を返す。bvec4 / bvec3 へは暗黙に変換できる。
+*/
+using bvec4m = GenBvec<LaneBool, 4>;
+using bvec3m = GenBvec2<LaneBool, 3, 4>;
+
 
 using mat4x4 = GenMat<float, 4, 4>;
 using mat4x3 = GenMat<float, 4, 3>;
@@ -2936,6 +6796,72 @@ using dmat3 = GenMat<double, 3, 3>;
 using dmat2 = GenMat<double, 2, 2>;
 using dmat1 = GenMat<double, 1, 1>;
 
+/*
+	列ごとに 4 成分分のメモリを持つ 3x3 行列（各列の w 成分はパディング）
+	列のストライドは std140 の mat3 と一致し、SIMD 演算の対象となる。
+*/
+using mat3a = GenMat2<float, 3, 3, 4>;
+using dmat3a = GenMat2<double, 3, 3, 4>;
+
+/*
+	列ごとに 4 成分分のメモリを持つ 4x3 行列（各列の w 成分はパディング）
+	アフィン変換（transformPoint composeAffine inverseAffine など）を全てレジスタ上で計算する。
+*/
+using mat4x3a = GenMat2<float, 4, 3, 4>;
+using dmat4x3a = GenMat2<double, 4, 3, 4>;
+
+/* 構造付き行列 */
+template<typename Element_t, int dim>
+using GenDiagonalMat = StructuredMat<Element_t, dim, MatStructure::diagonal>;
+template<typename Element_t, int dim>
+using GenTranslationMat = StructuredMat<Element_t, dim, MatStructure::translation>;
+template<typename Element_t, int dim>
+using GenRotationXMat = StructuredMat<Element_t, dim, MatStructure::rotationX>;
+template<typename Element_t, int dim>
+using GenRotationYMat = StructuredMat<Element_t, dim, MatStructure::rotationY>;
+template<typename Element_t, int dim>
+using GenRotationZMat = StructuredMat<Element_t, dim, MatStructure::rotationZ>;
+template<typename Element_t, int dim>
+using GenOrthonormalMat = StructuredMat<Element_t, dim, MatStructure::orthonormal>;
+
+using diagmat4 = GenDiagonalMat<float, 4>;
+using diagmat3 = GenDiagonalMat<float, 3>;
+using diagmat2 = GenDiagonalMat<float, 2>;
+using transmat4 = GenTranslationMat<float, 4>;
+using transmat3 = GenTranslationMat<float, 3>;
+using rotxmat3 = GenRotationXMat<float, 3>;
+using rotymat3 = GenRotationYMat<float, 3>;
+using rotzmat3 = GenRotationZMat<float, 3>;
+using orthomat3 = GenOrthonormalMat<float, 3>;
+using orthomat4 = GenOrthonormalMat<float, 4>;
+
+using ddiagmat4 = GenDiagonalMat<double, 4>;
+using ddiagmat3 = GenDiagonalMat<double, 3>;
+using ddiagmat2 = GenDiagonalMat<double, 2>;
+using dtransmat4 = GenTranslationMat<double, 4>;
+using dtransmat3 = GenTranslationMat<double, 3>;
+using drotxmat3 = GenRotationXMat<double, 3>;
+using drotymat3 = GenRotationYMat<double, 3>;
+using drotzmat3 = GenRotationZMat<double, 3>;
+using dorthomat3 = GenOrthonormalMat<double, 3>;
+using dorthomat4 = GenOrthonormalMat<double, 4>;
+
+/* 行優先の行列（rowmatCxR は C 列 R 行）*/
+template<typename Element_t, int opeDimC, int opeDimR>
+using GenRowMajorMat = RowMajorMat<Element_t, opeDimC, opeDimR, opeDimC>;
+
+using rowmat4 = GenRowMajorMat<float, 4, 4>;
+using rowmat3 = GenRowMajorMat<float, 3, 3>;
+using rowmat2 = GenRowMajorMat<float, 2, 2>;
+using rowmat4x3 = GenRowMajorMat<float, 4, 3>;
+using rowmat3x4 = GenRowMajorMat<float, 3, 4>;
+
+using drowmat4 = GenRowMajorMat<double, 4, 4>;
+using drowmat3 = GenRowMajorMat<double, 3, 3>;
+using drowmat2 = GenRowMajorMat<double, 2, 2>;
+using drowmat4x3 = GenRowMajorMat<double, 4, 3>;
+using drowmat3x4 = GenRowMajorMat<double, 3, 4>;
+
 
 };	/* namespace */
 